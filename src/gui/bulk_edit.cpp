@@ -0,0 +1,229 @@
+//========================================================================
+// Copyright (c) 2025 hung-truong
+
+#include "bulk_edit.h"
+#include "parallel_for.h"
+
+#include <algorithm>
+#include <bit>
+#include <cfloat>
+#include <cstring>
+#include <mutex>
+
+namespace {
+    constexpr size_t ShapesPerChunk = 16384;
+
+    // splitmix64, a cheap stateless hash that is good enough for test data
+    uint64_t mixBits(uint64_t x) {
+        x += 0x9E3779B97F4A7C15ull;
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+        return x ^ (x >> 31);
+    }
+
+    // Uniform float in [0, 1) from the top 24 bits
+    float unitFloat(uint64_t bits) {
+        return static_cast<float>(bits >> 40) / static_cast<float>(1 << 24);
+    }
+
+    // Packs a center and a scene index into one key whose unsigned order is (center, index),
+    // which sorts noticeably faster than comparing the pair field by field
+    uint64_t centerKey(float center, uint32_t index) {
+        uint32_t bits = std::bit_cast<uint32_t>(center);
+        bits = (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+        return (static_cast<uint64_t>(bits) << 32) | index;
+    }
+
+    float keyCenter(uint64_t key) {
+        uint32_t bits = static_cast<uint32_t>(key >> 32);
+        bits = (bits & 0x80000000u) ? (bits & 0x7FFFFFFFu) : ~bits;
+        return std::bit_cast<float>(bits);
+    }
+
+    float boundsCenter(const Shape& shape, BulkAxis axis) {
+        ImVec2 bounds_min, bounds_max;
+        shape.getBounds(bounds_min, bounds_max);
+        return axis == BulkAxis::Horizontal ? (bounds_min.x + bounds_max.x) * 0.5f
+                                            : (bounds_min.y + bounds_max.y) * 0.5f;
+    }
+}
+
+std::vector<uint32_t> BulkEdit::collect(const ShapeList& shapes, int selectedIndex, const BulkFilter& filter)
+{
+    std::vector<uint32_t> targets;
+    switch (filter.target) {
+    case BulkTarget::Selected:
+        if (selectedIndex >= 0 && selectedIndex < static_cast<int>(shapes.size())) {
+            targets.push_back(static_cast<uint32_t>(selectedIndex));
+        }
+        return targets;
+    case BulkTarget::All:
+        targets.resize(shapes.size());
+        for (size_t i = 0; i < shapes.size(); ++i) targets[i] = static_cast<uint32_t>(i);
+        return targets;
+    default:
+        break;
+    }
+
+    // Names are interned, so most name tests reduce to a lookup per distinct base string
+    const NameTable& names = NameTable::global();
+    std::vector<char> baseMatches;
+    if (filter.target == BulkTarget::NameContains) {
+        baseMatches.resize(names.size());
+        for (size_t id = 0; id < names.size(); ++id) {
+            baseMatches[id] = names.str(static_cast<NameId>(id)).find(filter.nameText) != std::string::npos;
+        }
+    }
+
+    // Flag matches in parallel, then compact in scene order
+    std::vector<char> matches(shapes.size(), 0);
+    parallelFor(shapes.size(), ShapesPerChunk, [&](size_t begin, size_t end) {
+        char name_buffer[160];
+        for (size_t i = begin; i < end; ++i) {
+            const Shape& shape = *shapes[i];
+            if (filter.target == BulkTarget::Type) {
+                matches[i] = std::strcmp(shape.typeName(), filter.typeName) == 0;
+            } else if (baseMatches[shape.name.base]) {
+                matches[i] = 1;
+            } else if (shape.name.copyCount > 0) {
+                // The " (Copy N)" suffix can complete a match the base string alone does not
+                names.format(shape.name, name_buffer, sizeof(name_buffer));
+                matches[i] = std::strstr(name_buffer, filter.nameText) != nullptr;
+            }
+        }
+    });
+    for (size_t i = 0; i < matches.size(); ++i) {
+        if (matches[i]) targets.push_back(static_cast<uint32_t>(i));
+    }
+    return targets;
+}
+
+void BulkEdit::translate(ShapeList& shapes, const std::vector<uint32_t>& targets, ImVec2 delta)
+{
+    parallelFor(targets.size(), ShapesPerChunk, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            Shape& shape = *shapes[targets[i]];
+            shape.position = ImVec2(shape.position.x + delta.x, shape.position.y + delta.y);
+        }
+    });
+}
+
+void BulkEdit::scale(ShapeList& shapes, const std::vector<uint32_t>& targets, float factor)
+{
+    if (factor <= 0.0f) return;
+    parallelFor(targets.size(), ShapesPerChunk, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            shapes[targets[i]]->scale(factor);
+        }
+    });
+}
+
+void BulkEdit::recolor(ShapeList& shapes, const std::vector<uint32_t>& targets, const std::array<float, 3>& col)
+{
+    parallelFor(targets.size(), ShapesPerChunk, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            shapes[targets[i]]->setColor(col);
+        }
+    });
+}
+
+void BulkEdit::align(ShapeList& shapes, const std::vector<uint32_t>& targets, BulkAlign edge)
+{
+    if (targets.empty()) return;
+
+    // Outermost edge over all targets, reduced per chunk then merged
+    const bool takeMax = edge == BulkAlign::Right || edge == BulkAlign::Bottom;
+    const bool horizontal = edge == BulkAlign::Left || edge == BulkAlign::Right;
+    auto edgeOf = [&](const Shape& shape) {
+        ImVec2 bounds_min, bounds_max;
+        shape.getBounds(bounds_min, bounds_max);
+        const ImVec2& bound = takeMax ? bounds_max : bounds_min;
+        return horizontal ? bound.x : bound.y;
+    };
+
+    std::mutex mergeMutex;
+    float outermost = takeMax ? -FLT_MAX : FLT_MAX;
+    parallelFor(targets.size(), ShapesPerChunk, [&](size_t begin, size_t end) {
+        float local = takeMax ? -FLT_MAX : FLT_MAX;
+        for (size_t i = begin; i < end; ++i) {
+            const float value = edgeOf(*shapes[targets[i]]);
+            local = takeMax ? std::max(local, value) : std::min(local, value);
+        }
+        std::lock_guard<std::mutex> lock(mergeMutex);
+        outermost = takeMax ? std::max(outermost, local) : std::min(outermost, local);
+    });
+
+    parallelFor(targets.size(), ShapesPerChunk, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            Shape& shape = *shapes[targets[i]];
+            const float offset = outermost - edgeOf(shape);
+            if (horizontal) {
+                shape.position.x += offset;
+            } else {
+                shape.position.y += offset;
+            }
+        }
+    });
+}
+
+void BulkEdit::distribute(ShapeList& shapes, const std::vector<uint32_t>& targets, BulkAxis axis)
+{
+    if (targets.size() < 3) return; // The two outermost shapes stay put
+
+    std::vector<uint64_t> order(targets.size());
+    parallelFor(targets.size(), ShapesPerChunk, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            order[i] = centerKey(boundsCenter(*shapes[targets[i]], axis), targets[i]);
+        }
+    });
+    // Ties keep scene order so repeated runs give the same layout
+    parallelSort(order, std::less<uint64_t>());
+
+    const float first = keyCenter(order.front());
+    const float step = (keyCenter(order.back()) - first) / static_cast<float>(order.size() - 1);
+    parallelFor(order.size(), ShapesPerChunk, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            Shape& shape = *shapes[static_cast<uint32_t>(order[i])];
+            const float offset = first + step * static_cast<float>(i) - keyCenter(order[i]);
+            if (axis == BulkAxis::Horizontal) {
+                shape.position.x += offset;
+            } else {
+                shape.position.y += offset;
+            }
+        }
+    });
+}
+
+void BulkEdit::randomize(ShapeList& shapes, const std::vector<uint32_t>& targets, const ImVec2& canvas_size,
+                         uint64_t seed, bool positions, bool colors)
+{
+    parallelFor(targets.size(), ShapesPerChunk, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const uint32_t index = targets[i];
+            Shape& shape = *shapes[index];
+            const uint64_t bits = mixBits(seed ^ (static_cast<uint64_t>(index) * 0xD1B54A32D192ED03ull));
+            if (positions) {
+                // Place the bounds, not the anchor point, so every shape type lands fully on the canvas
+                ImVec2 bounds_min, bounds_max;
+                shape.getBounds(bounds_min, bounds_max);
+                const float free_x = std::max(0.0f, canvas_size.x - (bounds_max.x - bounds_min.x));
+                const float free_y = std::max(0.0f, canvas_size.y - (bounds_max.y - bounds_min.y));
+                shape.position.x += unitFloat(bits) * free_x - bounds_min.x;
+                shape.position.y += unitFloat(mixBits(bits)) * free_y - bounds_min.y;
+            }
+            if (colors) {
+                const uint64_t color_bits = mixBits(bits ^ 0xC01042ull);
+                shape.setColor({unitFloat(color_bits), unitFloat(color_bits << 24), unitFloat(mixBits(color_bits))});
+            }
+        }
+    });
+}
+
+void BulkEdit::clampToCanvas(ShapeList& shapes, const std::vector<uint32_t>& targets, const ImVec2& canvas_size)
+{
+    parallelFor(targets.size(), ShapesPerChunk, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            shapes[targets[i]]->clampToCanvas(canvas_size);
+        }
+    });
+}
@@ -0,0 +1,51 @@
+//========================================================================
+// Copyright (c) 2025 hung-truong
+// --- Edits applied to many shapes at once on the thread pool ---
+
+#pragma once
+#include "shape.h"
+
+#include <cstdint>
+
+// Which shapes a bulk edit applies to
+enum class BulkTarget { Selected, All, Type, NameContains };
+
+struct BulkFilter {
+    BulkTarget target = BulkTarget::All;
+    const char* typeName = "";  // BulkTarget::Type, compared with Shape::typeName()
+    const char* nameText = "";  // BulkTarget::NameContains, case-sensitive substring of the display name
+};
+
+enum class BulkAlign { Left, Right, Top, Bottom };
+enum class BulkAxis { Horizontal, Vertical };
+
+// Every edit splits its targets into chunks on ThreadPool::global() and returns only once all
+// chunks are done, so the scene is never drawn with an edit half applied.
+// Targets are indices into `shapes`, as returned by collect(), and are edited independently.
+namespace BulkEdit {
+    using ShapeList = std::vector<std::unique_ptr<Shape>>;
+
+    // Indices of the shapes matching the filter, in scene order
+    std::vector<uint32_t> collect(const ShapeList& shapes, int selectedIndex, const BulkFilter& filter);
+
+    void translate(ShapeList& shapes, const std::vector<uint32_t>& targets, ImVec2 delta);
+
+    // Scales radius / size / vertices about each shape's own position
+    void scale(ShapeList& shapes, const std::vector<uint32_t>& targets, float factor);
+
+    void recolor(ShapeList& shapes, const std::vector<uint32_t>& targets, const std::array<float, 3>& col);
+
+    // Lines up the chosen bounding box edge of every target with the outermost one
+    void align(ShapeList& shapes, const std::vector<uint32_t>& targets, BulkAlign edge);
+
+    // Spaces the target centers evenly between the two outermost centers along the axis
+    void distribute(ShapeList& shapes, const std::vector<uint32_t>& targets, BulkAxis axis);
+
+    // Deterministic for a given seed: each shape's values are derived from its scene index,
+    // so the result does not depend on how the work was split between threads
+    void randomize(ShapeList& shapes, const std::vector<uint32_t>& targets, const ImVec2& canvas_size,
+                   uint64_t seed, bool positions, bool colors);
+
+    // Moves every target back inside the canvas with Shape::clampToCanvas()
+    void clampToCanvas(ShapeList& shapes, const std::vector<uint32_t>& targets, const ImVec2& canvas_size);
+}
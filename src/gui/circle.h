@@ -7,20 +7,17 @@ class CircleShape : public Shape {
 public:
     float radius;
 
-    CircleShape(ImVec2 pos, float r, const std::array<float, 3>& col, const std::string& n = "Circle")
+    CircleShape(ImVec2 pos, float r, const std::array<float, 3>& col, std::string_view n = "Circle")
+        : Shape(pos, col, n), radius(r) {}
+
+    CircleShape(ImVec2 pos, float r, const std::array<float, 3>& col, ShapeName n)
         : Shape(pos, col, n), radius(r) {}
 
     // Override draw function for CircleShape
     void draw(ImDrawList* draw_list, ImVec2 canvas_origin_screen_pos) const override {
         // Calculate absolute screen position for drawing
         ImVec2 screen_pos = ImVec2(canvas_origin_screen_pos.x + position.x, canvas_origin_screen_pos.y + position.y);
-        ImU32 drawColor = IM_COL32(
-            (int)(color[0] * 255),
-            (int)(color[1] * 255),
-            (int)(color[2] * 255),
-            255
-        );
-        draw_list->AddCircleFilled(screen_pos, radius, drawColor);
+        draw_list->AddCircleFilled(screen_pos, radius, packedColor);
         // Draw a border if selected
         if (isSelected) {
             draw_list->AddCircle(screen_pos, radius + 2.0f, IM_COL32(255, 255, 0, 255), 0, 2.0f); // Yellow border
@@ -34,6 +31,17 @@ public:
         return (dx * dx + dy * dy) <= (radius * radius);
     }
 
+    const char* typeName() const override { return "Circle"; }
+
+    void getBounds(ImVec2& bounds_min, ImVec2& bounds_max) const override {
+        bounds_min = ImVec2(position.x - radius, position.y - radius);
+        bounds_max = ImVec2(position.x + radius, position.y + radius);
+    }
+
+    void scale(float factor) override {
+        radius *= factor;
+    }
+
     void clampPosition(const ImVec2& canvas_size) override {
         ImVec2 newPosition = ImVec2(
             position.x + ImGui::GetIO().MouseDelta.x,
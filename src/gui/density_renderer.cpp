@@ -0,0 +1,201 @@
+//========================================================================
+// Copyright (c) 2025 hung-truong
+
+#include "density_renderer.h"
+#include "parallel_for.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+
+namespace {
+    // Coverage is stored in 1/16 pixel units so sub-pixel shapes still add up
+    constexpr uint64_t CoverageScale = 16;
+    constexpr size_t ShapesPerChunk = 16384;
+    constexpr size_t PixelsPerChunk = 65536;
+
+    void atomicAdd(uint64_t& target, uint64_t value) {
+        std::atomic_ref<uint64_t>(target).fetch_add(value, std::memory_order_relaxed);
+    }
+}
+
+void DensityRenderer::update(const std::vector<std::unique_ptr<Shape>>& shapes, uint64_t sceneVersion, int selectedIndex,
+                             const ImVec2& canvas_size, float sizeThreshold)
+{
+    const int width = static_cast<int>(canvas_size.x);
+    const int height = static_cast<int>(canvas_size.y);
+    const bool sameKey = hasGrid && sceneVersion == builtSceneVersion && selectedIndex == builtSelectedIndex &&
+                         sizeThreshold == builtThreshold && width == gridWidth && height == gridHeight;
+    if (sameKey && shapes.size() == builtShapeCount) {
+        return; // Nothing changed, reuse the texture
+    }
+    if (sameKey && shapes.size() > builtShapeCount) {
+        // Only appends since the last update: add the new shapes on top of the existing grid
+        splat(shapes, builtShapeCount, shapes.size(), selectedIndex, sizeThreshold);
+        builtShapeCount = shapes.size();
+        return;
+    }
+
+    gridWidth = width;
+    gridHeight = height;
+    rebuild(shapes, selectedIndex, sizeThreshold);
+
+    builtSceneVersion = sceneVersion;
+    builtSelectedIndex = selectedIndex;
+    builtThreshold = sizeThreshold;
+    builtShapeCount = shapes.size();
+    hasGrid = true;
+}
+
+void DensityRenderer::rebuild(const std::vector<std::unique_ptr<Shape>>& shapes, int selectedIndex, float sizeThreshold)
+{
+    const size_t cellCount = static_cast<size_t>(gridWidth) * gridHeight;
+    coverage.assign(cellCount, 0);
+    red.assign(cellCount, 0);
+    green.assign(cellCount, 0);
+    blue.assign(cellCount, 0);
+    pixels.assign(cellCount, 0);
+    detailedShapes.clear();
+    aggregatedShapes = 0;
+
+    splat(shapes, 0, shapes.size(), selectedIndex, sizeThreshold);
+    // Empty rows were cleared above and still need uploading
+    markRowsDirty(0, gridHeight);
+}
+
+void DensityRenderer::splat(const std::vector<std::unique_ptr<Shape>>& shapes, size_t first, size_t last,
+                            int selectedIndex, float sizeThreshold)
+{
+    // Splat every small shape into the pixel under its center
+    std::mutex mergeMutex;
+    const size_t detailedBefore = detailedShapes.size();
+    int touchedRowBegin = gridHeight;
+    int touchedRowEnd = 0;
+    parallelFor(last - first, ShapesPerChunk, [&](size_t begin, size_t end) {
+        std::vector<size_t> localDetailed;
+        size_t localAggregated = 0;
+        int localRowBegin = gridHeight;
+        int localRowEnd = 0;
+        for (size_t i = first + begin; i < first + end; ++i) {
+            if (static_cast<int>(i) == selectedIndex) continue;
+
+            const Shape& shape = *shapes[i];
+            ImVec2 bounds_min, bounds_max;
+            shape.getBounds(bounds_min, bounds_max);
+            const float w = bounds_max.x - bounds_min.x;
+            const float h = bounds_max.y - bounds_min.y;
+            if (std::max(w, h) >= sizeThreshold) {
+                localDetailed.push_back(i);
+                continue;
+            }
+
+            ++localAggregated;
+            const float cx = (bounds_min.x + bounds_max.x) * 0.5f;
+            const float cy = (bounds_min.y + bounds_max.y) * 0.5f;
+            if (cx < 0.0f || cy < 0.0f || cx >= gridWidth || cy >= gridHeight) continue; // Off canvas
+
+            const int row = static_cast<int>(cy);
+            localRowBegin = std::min(localRowBegin, row);
+            localRowEnd = std::max(localRowEnd, row + 1);
+            const size_t cell = static_cast<size_t>(row) * gridWidth + static_cast<size_t>(cx);
+            const uint64_t weight = std::max<uint64_t>(1, static_cast<uint64_t>(w * h * CoverageScale));
+            const ImU32 col = shape.packedColor;
+            atomicAdd(coverage[cell], weight);
+            atomicAdd(red[cell], weight * (col & 0xFF));
+            atomicAdd(green[cell], weight * ((col >> 8) & 0xFF));
+            atomicAdd(blue[cell], weight * ((col >> 16) & 0xFF));
+        }
+
+        std::lock_guard<std::mutex> lock(mergeMutex);
+        detailedShapes.insert(detailedShapes.end(), localDetailed.begin(), localDetailed.end());
+        aggregatedShapes += localAggregated;
+        touchedRowBegin = std::min(touchedRowBegin, localRowBegin);
+        touchedRowEnd = std::max(touchedRowEnd, localRowEnd);
+    });
+    // Chunks finish in any order, restore the scene's draw order. Appended indices are all
+    // larger than the existing ones, so only the new tail needs sorting.
+    std::sort(detailedShapes.begin() + detailedBefore, detailedShapes.end());
+    if (touchedRowBegin >= touchedRowEnd) return;
+
+    // Resolve the touched rows: average color per pixel, opacity from covered area
+    const size_t cellBegin = static_cast<size_t>(touchedRowBegin) * gridWidth;
+    const size_t cellEnd = static_cast<size_t>(touchedRowEnd) * gridWidth;
+    parallelFor(cellEnd - cellBegin, PixelsPerChunk, [&](size_t begin, size_t end) {
+        for (size_t cell = cellBegin + begin; cell < cellBegin + end; ++cell) {
+            const uint64_t covered = coverage[cell];
+            if (covered == 0) continue;
+            const uint64_t alpha = std::min<uint64_t>(255, covered * 255 / CoverageScale);
+            pixels[cell] = IM_COL32(red[cell] / covered, green[cell] / covered, blue[cell] / covered, alpha);
+        }
+    });
+    markRowsDirty(touchedRowBegin, touchedRowEnd);
+}
+
+void DensityRenderer::markRowsDirty(int rowBegin, int rowEnd)
+{
+    if (textureDirty) {
+        dirtyRowBegin = std::min(dirtyRowBegin, rowBegin);
+        dirtyRowEnd = std::max(dirtyRowEnd, rowEnd);
+    } else {
+        dirtyRowBegin = rowBegin;
+        dirtyRowEnd = rowEnd;
+        textureDirty = true;
+    }
+}
+
+void DensityRenderer::uploadTexture()
+{
+    textureDirty = false;
+    // No GL context during a headless replay: the grid is still built so its cost is measured
+    if (!glfwGetCurrentContext() || gridWidth <= 0 || gridHeight <= 0) return;
+
+    if (textureId == 0) {
+        glGenTextures(1, &textureId);
+    }
+    glBindTexture(GL_TEXTURE_2D, textureId);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    if (textureWidth != gridWidth || textureHeight != gridHeight) {
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, gridWidth, gridHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+        textureWidth = gridWidth;
+        textureHeight = gridHeight;
+    } else if (dirtyRowBegin < dirtyRowEnd) {
+        // Only the rows touched since the last upload
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, dirtyRowBegin, gridWidth, dirtyRowEnd - dirtyRowBegin, GL_RGBA,
+                        GL_UNSIGNED_BYTE, pixels.data() + static_cast<size_t>(dirtyRowBegin) * gridWidth);
+    }
+}
+
+void DensityRenderer::draw(ImDrawList* draw_list, ImVec2 canvas_pos, const std::vector<std::unique_ptr<Shape>>& shapes,
+                           int selectedIndex)
+{
+    if (textureDirty) {
+        uploadTexture();
+    }
+    if (textureId != 0) {
+        draw_list->AddImage((ImTextureID)(intptr_t)textureId, canvas_pos,
+                            ImVec2(canvas_pos.x + textureWidth, canvas_pos.y + textureHeight));
+    }
+
+    for (size_t index : detailedShapes) {
+        if (index < shapes.size()) {
+            shapes[index]->draw(draw_list, canvas_pos);
+        }
+    }
+    if (selectedIndex >= 0 && selectedIndex < static_cast<int>(shapes.size())) {
+        shapes[selectedIndex]->draw(draw_list, canvas_pos);
+    }
+}
+
+void DensityRenderer::releaseTexture()
+{
+    if (textureId != 0) {
+        glDeleteTextures(1, &textureId);
+        textureId = 0;
+        textureWidth = textureHeight = 0;
+    }
+    hasGrid = false; // Force a rebuild and upload if drawing resumes
+}
@@ -0,0 +1,71 @@
+//========================================================================
+// Copyright (c) 2025 hung-truong
+// --- Draws a dense scene as one screen-resolution density texture ---
+
+#pragma once
+#include "shape.h"
+
+#include <cstdint>
+
+// Shapes smaller than a pixel threshold are splatted into a per-pixel coverage/color grid,
+// which is uploaded as a single texture. Larger shapes are listed for normal drawing.
+// The grid is only rebuilt when the scene, the selection or the canvas size changes,
+// so an unchanged overview costs the same per frame regardless of the shape count.
+// Shapes appended without a version change (progressive loading) are splatted into the
+// existing grid, so each loaded chunk only costs as much as the shapes it added.
+class DensityRenderer {
+private:
+    // Cache key of the current grid
+    uint64_t builtSceneVersion = 0;
+    int builtSelectedIndex = -1;
+    size_t builtShapeCount = 0; // shapes[0, builtShapeCount) are already in the grid
+    float builtThreshold = 0.0f;
+    int gridWidth = 0;
+    int gridHeight = 0;
+    bool hasGrid = false;
+
+    // Accumulators, one entry per pixel, updated with atomic adds from the worker threads
+    std::vector<uint64_t> coverage; // Covered area in 1/16 pixel units
+    std::vector<uint64_t> red, green, blue; // Color channels weighted by coverage
+    std::vector<uint32_t> pixels; // Resolved RGBA8 image
+    std::vector<size_t> detailedShapes; // Shapes at or above the threshold
+    size_t aggregatedShapes = 0;
+
+    unsigned int textureId = 0;
+    int textureWidth = 0;
+    int textureHeight = 0;
+    bool textureDirty = false;
+    // Rows of `pixels` changed since the last upload, [dirtyRowBegin, dirtyRowEnd)
+    int dirtyRowBegin = 0;
+    int dirtyRowEnd = 0;
+
+    void rebuild(const std::vector<std::unique_ptr<Shape>>& shapes, int selectedIndex, float sizeThreshold);
+    // Adds shapes[begin, end) to the accumulators and resolves the rows they touched
+    void splat(const std::vector<std::unique_ptr<Shape>>& shapes, size_t begin, size_t end, int selectedIndex,
+               float sizeThreshold);
+    void markRowsDirty(int rowBegin, int rowEnd);
+    void uploadTexture();
+
+public:
+    // Rebuilds the grid if anything it depends on changed since the last call, or only adds
+    // the shapes appended since then when the version is unchanged.
+    // The selected shape is never aggregated so it can be dragged without a rebuild.
+    void update(const std::vector<std::unique_ptr<Shape>>& shapes, uint64_t sceneVersion, int selectedIndex,
+                const ImVec2& canvas_size, float sizeThreshold);
+
+    // Draws the density texture over the canvas, then the detailed and selected shapes on top
+    void draw(ImDrawList* draw_list, ImVec2 canvas_pos, const std::vector<std::unique_ptr<Shape>>& shapes,
+              int selectedIndex);
+
+    size_t aggregatedCount() const { return aggregatedShapes; }
+    size_t detailedCount() const { return detailedShapes.size(); }
+
+    // Drops the cached grid, for when shapes may have changed while the overview was not updated
+    void invalidate() { hasGrid = false; }
+
+    // GPU memory held by the density texture
+    size_t textureBytes() const { return static_cast<size_t>(textureWidth) * textureHeight * 4; }
+
+    // Frees the GL texture, must run while the GL context is still alive
+    void releaseTexture();
+};
@@ -0,0 +1,52 @@
+//========================================================================
+// Copyright (c) 2025 hung-truong
+// --- Collects per-frame CPU times and prints a summary report ---
+
+#pragma once
+#include <algorithm>
+#include <cstdio>
+#include <numeric>
+#include <ostream>
+#include <vector>
+
+class FrameTimeStats {
+private:
+    std::vector<double> samplesMs; // One entry per frame, in milliseconds
+
+    // Nearest-rank percentile over an already sorted sample list
+    static double percentile(const std::vector<double>& sorted, double p) {
+        if (sorted.empty()) return 0.0;
+        size_t rank = static_cast<size_t>(p / 100.0 * (sorted.size() - 1) + 0.5);
+        return sorted[std::min(rank, sorted.size() - 1)];
+    }
+
+public:
+    void addSample(double ms) { samplesMs.push_back(ms); }
+
+    size_t count() const { return samplesMs.size(); }
+
+    void clear() { samplesMs.clear(); }
+
+    // Prints frame count, total, mean and min/percentile/max frame times
+    void report(std::ostream& os, const char* title) const {
+        os << "--- " << title << " ---\n";
+        if (samplesMs.empty()) {
+            os << "  no frames recorded\n";
+            return;
+        }
+
+        std::vector<double> sorted(samplesMs);
+        std::sort(sorted.begin(), sorted.end());
+        double total = std::accumulate(sorted.begin(), sorted.end(), 0.0);
+        double mean = total / sorted.size();
+
+        char line[256];
+        snprintf(line, sizeof(line), "  frames: %zu, total: %.2f ms, mean: %.3f ms (%.1f fps)\n",
+                 sorted.size(), total, mean, mean > 0.0 ? 1000.0 / mean : 0.0);
+        os << line;
+        snprintf(line, sizeof(line), "  min: %.3f ms, p50: %.3f ms, p95: %.3f ms, p99: %.3f ms, max: %.3f ms\n",
+                 sorted.front(), percentile(sorted, 50.0), percentile(sorted, 95.0),
+                 percentile(sorted, 99.0), sorted.back());
+        os << line;
+    }
+};
@@ -0,0 +1,246 @@
+//========================================================================
+// Copyright (c) 2025 hung-truong
+
+#include "input_recorder.h"
+
+namespace {
+    // Keyboard and gamepad keys come first in the named key range; mouse keys and the
+    // reserved modifier slots follow ImGuiKey_MouseLeft and are recorded separately.
+    constexpr int FirstRecordedKey = ImGuiKey_NamedKey_BEGIN;
+    constexpr int LastRecordedKey = ImGuiKey_MouseLeft; // Exclusive
+    constexpr ImGuiKey ModifierKeys[] = { ImGuiMod_Ctrl, ImGuiMod_Shift, ImGuiMod_Alt, ImGuiMod_Super };
+    constexpr size_t RecordedKeyCount = (LastRecordedKey - FirstRecordedKey) + IM_ARRAYSIZE(ModifierKeys);
+
+    bool isModifierDown(const ImGuiIO& io, ImGuiKey mod) {
+        switch (mod) {
+            case ImGuiMod_Ctrl:  return io.KeyCtrl;
+            case ImGuiMod_Shift: return io.KeyShift;
+            case ImGuiMod_Alt:   return io.KeyAlt;
+            default:             return io.KeySuper;
+        }
+    }
+
+    template<typename T>
+    void writeValue(std::ofstream& out, const T& value) {
+        out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template<typename T>
+    bool readValue(std::ifstream& in, T& value) {
+        return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(T)));
+    }
+
+    bool sameVec2(const ImVec2& a, const ImVec2& b) {
+        return a.x == b.x && a.y == b.y;
+    }
+}
+
+bool InputRecorder::start(const std::string& path, const RecordedScene& scene)
+{
+    logFile.open(path, std::ios::binary | std::ios::trunc);
+    if (!logFile) {
+        return false;
+    }
+    logFile.write(InputLog::Magic, sizeof(InputLog::Magic));
+    writeValue(logFile, InputLog::Version);
+    writeValue(logFile, scene.generatedShapes);
+    writeValue(logFile, scene.seed);
+
+    keyDown.assign(RecordedKeyCount, false);
+    hasPreviousFrame = false;
+    return true;
+}
+
+void InputRecorder::captureFrame(uint32_t shapesLoaded, bool sceneFinished)
+{
+    if (!isRecording()) return;
+
+    const ImGuiIO& io = ImGui::GetIO();
+    RecordedFrame frame;
+    frame.deltaTime = io.DeltaTime;
+    frame.displaySize = io.DisplaySize;
+    frame.mousePos = io.MousePos;
+    for (int button = 0; button < 5; ++button) {
+        if (io.MouseDown[button]) {
+            frame.mouseButtons |= static_cast<uint8_t>(1 << button);
+        }
+    }
+    frame.mouseWheel = ImVec2(io.MouseWheelH, io.MouseWheel);
+    frame.shapesLoaded = shapesLoaded;
+    frame.sceneFinished = sceneFinished;
+
+    // Only key transitions are logged, a held key costs nothing after its first frame
+    size_t slot = 0;
+    for (int key = FirstRecordedKey; key < LastRecordedKey; ++key, ++slot) {
+        bool down = ImGui::IsKeyDown(static_cast<ImGuiKey>(key));
+        if (down != keyDown[slot]) {
+            keyDown[slot] = down;
+            frame.keyEvents.emplace_back(static_cast<uint16_t>(key), down);
+        }
+    }
+    for (ImGuiKey mod : ModifierKeys) {
+        bool down = isModifierDown(io, mod);
+        if (down != keyDown[slot]) {
+            keyDown[slot] = down;
+            frame.keyEvents.emplace_back(static_cast<uint16_t>(mod), down);
+        }
+        ++slot;
+    }
+
+    for (int i = 0; i < io.InputQueueCharacters.Size; ++i) {
+        frame.characters.push_back(io.InputQueueCharacters[i]);
+    }
+
+    uint8_t flags = 0;
+    if (!hasPreviousFrame || !sameVec2(frame.displaySize, previousFrame.displaySize)) flags |= InputLog::DisplaySizeChanged;
+    if (!hasPreviousFrame || !sameVec2(frame.mousePos, previousFrame.mousePos))       flags |= InputLog::MousePosChanged;
+    if (!hasPreviousFrame || frame.mouseButtons != previousFrame.mouseButtons)        flags |= InputLog::MouseButtonsChanged;
+    if (frame.mouseWheel.x != 0.0f || frame.mouseWheel.y != 0.0f)                     flags |= InputLog::MouseWheelMoved;
+    if (!frame.keyEvents.empty())                                                     flags |= InputLog::HasKeyEvents;
+    if (!frame.characters.empty())                                                    flags |= InputLog::HasCharacters;
+    if (frame.shapesLoaded > 0)                                                       flags |= InputLog::HasShapesLoaded;
+    if (frame.sceneFinished)                                                          flags |= InputLog::SceneFinished;
+
+    writeValue(logFile, flags);
+    writeValue(logFile, frame.deltaTime);
+    if (flags & InputLog::DisplaySizeChanged) {
+        writeValue(logFile, frame.displaySize.x);
+        writeValue(logFile, frame.displaySize.y);
+    }
+    if (flags & InputLog::MousePosChanged) {
+        writeValue(logFile, frame.mousePos.x);
+        writeValue(logFile, frame.mousePos.y);
+    }
+    if (flags & InputLog::MouseButtonsChanged) {
+        writeValue(logFile, frame.mouseButtons);
+    }
+    if (flags & InputLog::MouseWheelMoved) {
+        writeValue(logFile, frame.mouseWheel.x);
+        writeValue(logFile, frame.mouseWheel.y);
+    }
+    if (flags & InputLog::HasKeyEvents) {
+        writeValue(logFile, static_cast<uint16_t>(frame.keyEvents.size()));
+        for (const auto& [key, down] : frame.keyEvents) {
+            writeValue(logFile, key);
+            writeValue(logFile, static_cast<uint8_t>(down));
+        }
+    }
+    if (flags & InputLog::HasCharacters) {
+        writeValue(logFile, static_cast<uint16_t>(frame.characters.size()));
+        for (uint32_t c : frame.characters) {
+            writeValue(logFile, c);
+        }
+    }
+    if (flags & InputLog::HasShapesLoaded) {
+        writeValue(logFile, frame.shapesLoaded);
+    }
+
+    previousFrame = std::move(frame);
+    hasPreviousFrame = true;
+}
+
+void InputRecorder::stop()
+{
+    if (logFile.is_open()) {
+        logFile.close();
+    }
+}
+
+bool InputReplayer::load(const std::string& path)
+{
+    frames.clear();
+    nextFrame = 0;
+    recordedScene = RecordedScene();
+
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        return false;
+    }
+
+    char magic[sizeof(InputLog::Magic)];
+    uint32_t version = 0;
+    if (!in.read(magic, sizeof(magic)) || !readValue(in, version) ||
+        std::char_traits<char>::compare(magic, InputLog::Magic, sizeof(magic)) != 0 ||
+        version != InputLog::Version ||
+        !readValue(in, recordedScene.generatedShapes) || !readValue(in, recordedScene.seed)) {
+        return false;
+    }
+
+    // Each frame starts from the previous one, then the flagged fields overwrite it
+    RecordedFrame frame;
+    uint8_t flags = 0;
+    while (readValue(in, flags)) {
+        frame.keyEvents.clear();
+        frame.characters.clear();
+        frame.mouseWheel = ImVec2(0.0f, 0.0f);
+        frame.shapesLoaded = 0;
+        frame.sceneFinished = (flags & InputLog::SceneFinished) != 0;
+
+        bool ok = readValue(in, frame.deltaTime);
+        if (ok && (flags & InputLog::DisplaySizeChanged)) {
+            ok = readValue(in, frame.displaySize.x) && readValue(in, frame.displaySize.y);
+        }
+        if (ok && (flags & InputLog::MousePosChanged)) {
+            ok = readValue(in, frame.mousePos.x) && readValue(in, frame.mousePos.y);
+        }
+        if (ok && (flags & InputLog::MouseButtonsChanged)) {
+            ok = readValue(in, frame.mouseButtons);
+        }
+        if (ok && (flags & InputLog::MouseWheelMoved)) {
+            ok = readValue(in, frame.mouseWheel.x) && readValue(in, frame.mouseWheel.y);
+        }
+        if (ok && (flags & InputLog::HasKeyEvents)) {
+            uint16_t count = 0;
+            ok = readValue(in, count);
+            for (uint16_t i = 0; ok && i < count; ++i) {
+                uint16_t key = 0;
+                uint8_t down = 0;
+                ok = readValue(in, key) && readValue(in, down);
+                frame.keyEvents.emplace_back(key, down != 0);
+            }
+        }
+        if (ok && (flags & InputLog::HasCharacters)) {
+            uint16_t count = 0;
+            ok = readValue(in, count);
+            for (uint16_t i = 0; ok && i < count; ++i) {
+                uint32_t c = 0;
+                ok = readValue(in, c);
+                frame.characters.push_back(c);
+            }
+        }
+        if (ok && (flags & InputLog::HasShapesLoaded)) {
+            ok = readValue(in, frame.shapesLoaded);
+        }
+        if (!ok) {
+            frames.clear();
+            return false; // Truncated log
+        }
+        frames.push_back(frame);
+    }
+    return true;
+}
+
+const RecordedFrame& InputReplayer::feedNextFrame()
+{
+    IM_ASSERT(hasNextFrame());
+    const RecordedFrame& frame = frames[nextFrame++];
+    ImGuiIO& io = ImGui::GetIO();
+    io.DeltaTime = frame.deltaTime > 0.0f ? frame.deltaTime : 1.0f / 60.0f; // ImGui asserts on a zero step
+    io.DisplaySize = frame.displaySize;
+
+    // ImGui drops events that do not change the current state, so the full state can be pushed every frame
+    io.AddMousePosEvent(frame.mousePos.x, frame.mousePos.y);
+    for (int button = 0; button < 5; ++button) {
+        io.AddMouseButtonEvent(button, (frame.mouseButtons & (1 << button)) != 0);
+    }
+    if (frame.mouseWheel.x != 0.0f || frame.mouseWheel.y != 0.0f) {
+        io.AddMouseWheelEvent(frame.mouseWheel.x, frame.mouseWheel.y);
+    }
+    for (const auto& [key, down] : frame.keyEvents) {
+        io.AddKeyEvent(static_cast<ImGuiKey>(key), down);
+    }
+    for (uint32_t c : frame.characters) {
+        io.AddInputCharacter(c);
+    }
+    return frame;
+}
@@ -0,0 +1,96 @@
+//========================================================================
+// Copyright (c) 2025 hung-truong
+// --- Records ImGui input to a compact binary log and replays it frame by frame ---
+
+#pragma once
+#include <imgui.h>
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// The input state ImGui saw during one frame, captured after ImGui::NewFrame()
+struct RecordedFrame {
+    float deltaTime = 0.0f;
+    ImVec2 displaySize;
+    ImVec2 mousePos;
+    uint8_t mouseButtons = 0; // Bit N is set while ImGuiMouseButton N is held
+    ImVec2 mouseWheel;        // x = horizontal, y = vertical
+    std::vector<std::pair<uint16_t, bool>> keyEvents; // Key transitions since the previous frame
+    std::vector<uint32_t> characters;                  // Text input typed during the frame
+    uint32_t shapesLoaded = 0; // Scene shapes inserted by the progressive loader before this frame
+    bool sceneFinished = false; // The loader found its source exhausted before this frame
+};
+
+// The generated scene a session was recorded against; replay refuses to run against another one
+struct RecordedScene {
+    uint64_t generatedShapes = 0; // 0 = default scene only
+    uint32_t seed = 0;
+
+    bool operator==(const RecordedScene&) const = default;
+};
+
+// Log layout (host byte order):
+//   header: "SFIR" magic, uint32 version, uint64 generated scene size, uint32 scene seed
+//   frame:  uint8 flags, float deltaTime, then only the fields whose flag bit is set
+// Unchanged mouse/display state is not written again, so idle frames cost 5 bytes.
+namespace InputLog {
+    constexpr char Magic[4] = {'S', 'F', 'I', 'R'};
+    constexpr uint32_t Version = 3;
+
+    enum FrameFlags : uint8_t {
+        DisplaySizeChanged  = 1 << 0,
+        MousePosChanged     = 1 << 1,
+        MouseButtonsChanged = 1 << 2,
+        MouseWheelMoved     = 1 << 3,
+        HasKeyEvents        = 1 << 4,
+        HasCharacters       = 1 << 5,
+        HasShapesLoaded     = 1 << 6,
+        SceneFinished       = 1 << 7,
+    };
+}
+
+class InputRecorder {
+private:
+    std::ofstream logFile;
+    RecordedFrame previousFrame;
+    bool hasPreviousFrame = false;
+    // Last seen down state of every named keyboard/gamepad key plus the four modifiers
+    std::vector<bool> keyDown;
+
+public:
+    // Opens the log file and writes its header. Returns false if the file cannot be created.
+    bool start(const std::string& path, const RecordedScene& scene);
+
+    bool isRecording() const { return logFile.is_open(); }
+
+    // Appends the current frame's input and the scene loading done before it to the log.
+    // Must be called right after ImGui::NewFrame() so the IO state reflects this frame.
+    void captureFrame(uint32_t shapesLoaded, bool sceneFinished);
+
+    void stop();
+};
+
+class InputReplayer {
+private:
+    std::vector<RecordedFrame> frames;
+    size_t nextFrame = 0;
+    RecordedScene recordedScene;
+
+public:
+    // Reads a whole log into memory. Returns false on a missing file, bad header or truncated data.
+    bool load(const std::string& path);
+
+    bool hasNextFrame() const { return nextFrame < frames.size(); }
+
+    size_t frameCount() const { return frames.size(); }
+
+    const RecordedScene& scene() const { return recordedScene; }
+
+    // Pushes the next recorded frame into the ImGui IO queue and returns it, so the caller can
+    // load the same number of scene shapes. Requires hasNextFrame().
+    // Must be called right before ImGui::NewFrame().
+    const RecordedFrame& feedNextFrame();
+};
@@ -0,0 +1,228 @@
+//========================================================================
+// Copyright (c) 2025 hung-truong
+
+#include "memory_telemetry.h"
+
+#include <imgui.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <new>
+#include <ostream>
+
+namespace {
+    constexpr size_t SubsystemCount = static_cast<size_t>(MemorySubsystem::Count);
+
+    struct AtomicCounters {
+        std::atomic<int64_t> liveBytes{0};
+        std::atomic<int64_t> liveAllocations{0};
+        std::atomic<int64_t> totalAllocations{0};
+        std::atomic<int64_t> totalBytes{0};
+    };
+
+    // Constant-initialized, so they are usable by allocations made during static initialization
+    AtomicCounters counters[SubsystemCount];
+    std::atomic<int64_t> frameStartAllocations{0};
+    std::atomic<int64_t> frameStartBytes{0};
+    MemorySnapshot lastFrame; // Main thread only
+    thread_local MemorySubsystem currentSubsystem = MemorySubsystem::Other;
+
+    // Snapshot export state (main thread only)
+    std::unique_ptr<std::ofstream> snapshotFile;
+    double snapshotInterval = 1.0;
+    std::chrono::steady_clock::time_point snapshotStart;
+    std::chrono::steady_clock::time_point nextSnapshot;
+
+    int64_t allAllocations() {
+        int64_t total = 0;
+        for (const AtomicCounters& c : counters) total += c.totalAllocations.load(std::memory_order_relaxed);
+        return total;
+    }
+
+    int64_t allBytes() {
+        int64_t total = 0;
+        for (const AtomicCounters& c : counters) total += c.totalBytes.load(std::memory_order_relaxed);
+        return total;
+    }
+
+#ifdef SHAPEFORGE_MEMORY_TELEMETRY
+    // Every counted block starts with this header; 16 bytes keeps the user pointer max-aligned
+    struct alignas(16) AllocationHeader {
+        size_t size;
+        MemorySubsystem subsystem;
+    };
+    static_assert(sizeof(AllocationHeader) == 16);
+
+    void* countedAlloc(size_t size, MemorySubsystem subsystem) {
+        auto* header = static_cast<AllocationHeader*>(std::malloc(sizeof(AllocationHeader) + size));
+        if (!header) return nullptr;
+        header->size = size;
+        header->subsystem = subsystem;
+
+        AtomicCounters& c = counters[static_cast<size_t>(subsystem)];
+        c.liveBytes.fetch_add(static_cast<int64_t>(size), std::memory_order_relaxed);
+        c.liveAllocations.fetch_add(1, std::memory_order_relaxed);
+        c.totalAllocations.fetch_add(1, std::memory_order_relaxed);
+        c.totalBytes.fetch_add(static_cast<int64_t>(size), std::memory_order_relaxed);
+        return header + 1;
+    }
+
+    void countedFree(void* ptr) {
+        if (!ptr) return;
+        auto* header = static_cast<AllocationHeader*>(ptr) - 1;
+        AtomicCounters& c = counters[static_cast<size_t>(header->subsystem)];
+        c.liveBytes.fetch_sub(static_cast<int64_t>(header->size), std::memory_order_relaxed);
+        c.liveAllocations.fetch_sub(1, std::memory_order_relaxed);
+        std::free(header);
+    }
+
+    void* imguiAlloc(size_t size, void*) { return countedAlloc(size, MemorySubsystem::ImGui); }
+    void imguiFree(void* ptr, void*) { countedFree(ptr); }
+#endif
+}
+
+#ifdef SHAPEFORGE_MEMORY_TELEMETRY
+// --- Global allocation hooks (over-aligned new/delete keep the default implementation) ---
+void* operator new(size_t size) {
+    if (void* ptr = countedAlloc(size, currentSubsystem)) return ptr;
+    throw std::bad_alloc();
+}
+void* operator new[](size_t size) {
+    if (void* ptr = countedAlloc(size, currentSubsystem)) return ptr;
+    throw std::bad_alloc();
+}
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return countedAlloc(size, currentSubsystem); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return countedAlloc(size, currentSubsystem); }
+void operator delete(void* ptr) noexcept { countedFree(ptr); }
+void operator delete[](void* ptr) noexcept { countedFree(ptr); }
+void operator delete(void* ptr, size_t) noexcept { countedFree(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { countedFree(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { countedFree(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { countedFree(ptr); }
+#endif
+
+MemoryScope::MemoryScope(MemorySubsystem subsystem)
+    : previous(currentSubsystem)
+{
+    currentSubsystem = subsystem;
+}
+
+MemoryScope::~MemoryScope()
+{
+    currentSubsystem = previous;
+}
+
+bool MemoryTelemetry::isEnabled()
+{
+#ifdef SHAPEFORGE_MEMORY_TELEMETRY
+    return true;
+#else
+    return false;
+#endif
+}
+
+const char* MemoryTelemetry::subsystemName(MemorySubsystem subsystem)
+{
+    switch (subsystem) {
+        case MemorySubsystem::SceneStorage: return "scene_storage";
+        case MemorySubsystem::Clipboard:    return "clipboard";
+        case MemorySubsystem::Names:        return "names";
+        case MemorySubsystem::ImGui:        return "imgui";
+        case MemorySubsystem::DrawLists:    return "imgui_draw_lists";
+        case MemorySubsystem::GLBuffers:    return "gl_buffers";
+        default:                            return "other";
+    }
+}
+
+void MemoryTelemetry::installImGuiAllocator()
+{
+#ifdef SHAPEFORGE_MEMORY_TELEMETRY
+    ImGui::SetAllocatorFunctions(imguiAlloc, imguiFree, nullptr);
+#endif
+}
+
+void MemoryTelemetry::setGauge(MemorySubsystem subsystem, int64_t bytes)
+{
+    counters[static_cast<size_t>(subsystem)].liveBytes.store(bytes, std::memory_order_relaxed);
+}
+
+MemorySnapshot MemoryTelemetry::snapshot()
+{
+    MemorySnapshot snap = lastFrame;
+    for (size_t i = 0; i < SubsystemCount; ++i) {
+        snap.subsystems[i].liveBytes = counters[i].liveBytes.load(std::memory_order_relaxed);
+        snap.subsystems[i].liveAllocations = counters[i].liveAllocations.load(std::memory_order_relaxed);
+        snap.subsystems[i].totalAllocations = counters[i].totalAllocations.load(std::memory_order_relaxed);
+        snap.subsystems[i].totalBytes = counters[i].totalBytes.load(std::memory_order_relaxed);
+    }
+    return snap;
+}
+
+void MemoryTelemetry::beginFrameCounting()
+{
+    frameStartAllocations.store(allAllocations(), std::memory_order_relaxed);
+    frameStartBytes.store(allBytes(), std::memory_order_relaxed);
+}
+
+void MemoryTelemetry::endFrame(size_t shapeCount)
+{
+    const int64_t allocations = allAllocations();
+    const int64_t bytes = allBytes();
+    lastFrame.frame++;
+    lastFrame.frameAllocations = allocations - frameStartAllocations.exchange(allocations);
+    lastFrame.frameBytes = bytes - frameStartBytes.exchange(bytes);
+    if (lastFrame.frameAllocations > lastFrame.peakFrameAllocations) {
+        lastFrame.peakFrameAllocations = lastFrame.frameAllocations;
+    }
+
+    if (snapshotFile && std::chrono::steady_clock::now() >= nextSnapshot) {
+        nextSnapshot += std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double>(snapshotInterval));
+        writeJson(*snapshotFile, snapshot(), shapeCount);
+        *snapshotFile << '\n';
+        snapshotFile->flush();
+    }
+}
+
+bool MemoryTelemetry::startSnapshots(const std::string& path, double intervalSeconds)
+{
+    snapshotFile = std::make_unique<std::ofstream>(path, std::ios::trunc);
+    if (!*snapshotFile) {
+        snapshotFile.reset();
+        return false;
+    }
+    snapshotInterval = intervalSeconds;
+    snapshotStart = nextSnapshot = std::chrono::steady_clock::now();
+    return true;
+}
+
+void MemoryTelemetry::writeJson(std::ostream& os, const MemorySnapshot& snap, size_t shapeCount)
+{
+    const double elapsed = snapshotFile
+        ? std::chrono::duration<double>(std::chrono::steady_clock::now() - snapshotStart).count()
+        : 0.0;
+    const int64_t sceneBytes = snap.subsystems[static_cast<size_t>(MemorySubsystem::SceneStorage)].liveBytes;
+
+    char buffer[256];
+    snprintf(buffer, sizeof(buffer),
+             "{\"time_s\":%.3f,\"frame\":%llu,\"frame_allocations\":%lld,\"frame_bytes\":%lld,"
+             "\"peak_frame_allocations\":%lld,\"shapes\":%zu,\"scene_bytes_per_shape\":%.1f,\"subsystems\":{",
+             elapsed, static_cast<unsigned long long>(snap.frame), static_cast<long long>(snap.frameAllocations),
+             static_cast<long long>(snap.frameBytes), static_cast<long long>(snap.peakFrameAllocations), shapeCount,
+             shapeCount > 0 ? static_cast<double>(sceneBytes) / shapeCount : 0.0);
+    os << buffer;
+    for (size_t i = 0; i < SubsystemCount; ++i) {
+        const SubsystemStats& s = snap.subsystems[i];
+        snprintf(buffer, sizeof(buffer),
+                 "%s\"%s\":{\"live_bytes\":%lld,\"live_allocations\":%lld,\"total_allocations\":%lld,\"total_bytes\":%lld}",
+                 i > 0 ? "," : "", subsystemName(static_cast<MemorySubsystem>(i)),
+                 static_cast<long long>(s.liveBytes), static_cast<long long>(s.liveAllocations),
+                 static_cast<long long>(s.totalAllocations), static_cast<long long>(s.totalBytes));
+        os << buffer;
+    }
+    os << "}}";
+}
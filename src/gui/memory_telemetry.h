@@ -0,0 +1,78 @@
+//========================================================================
+// Copyright (c) 2025 hung-truong
+// --- Per-subsystem heap accounting for the editor ---
+// With SHAPEFORGE_MEMORY_TELEMETRY defined, the global operator new/delete and the ImGui
+// allocator are replaced by counting versions that tag every block with the subsystem that
+// was active (see MemoryScope) when it was allocated, so frees are attributed correctly too.
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+enum class MemorySubsystem : uint32_t {
+    Other,        // Anything allocated outside a MemoryScope
+    SceneStorage, // Shapes, the shape vector and cached shape geometry
+    Clipboard,
+    Names,        // NameTable strings and lookup
+    ImGui,        // All ImGui heap use: draw lists, windows, font atlas
+    DrawLists,    // Gauge: capacity of the last frame's ImDrawList buffers (part of ImGui)
+    GLBuffers,    // Gauge: GPU textures and streamed vertex/index buffers (not heap)
+    Count
+};
+
+struct SubsystemStats {
+    int64_t liveBytes = 0;
+    int64_t liveAllocations = 0;
+    int64_t totalAllocations = 0;
+    int64_t totalBytes = 0;
+};
+
+struct MemorySnapshot {
+    SubsystemStats subsystems[static_cast<size_t>(MemorySubsystem::Count)];
+    uint64_t frame = 0;
+    int64_t frameAllocations = 0; // Heap allocations made during the last completed frame
+    int64_t frameBytes = 0;
+    int64_t peakFrameAllocations = 0;
+};
+
+// Attributes heap allocations made on this thread to a subsystem until the scope ends
+class MemoryScope {
+private:
+    MemorySubsystem previous;
+
+public:
+    explicit MemoryScope(MemorySubsystem subsystem);
+    ~MemoryScope();
+    MemoryScope(const MemoryScope&) = delete;
+    MemoryScope& operator=(const MemoryScope&) = delete;
+};
+
+class MemoryTelemetry {
+public:
+    // False when built without SHAPEFORGE_MEMORY_TELEMETRY; counters then stay at zero
+    static bool isEnabled();
+
+    static const char* subsystemName(MemorySubsystem subsystem);
+
+    // Routes ImGui's allocations through the counters. Must be called before ImGui::CreateContext().
+    static void installImGuiAllocator();
+
+    // Replaces the live byte count of a subsystem that is measured rather than hooked (GL)
+    static void setGauge(MemorySubsystem subsystem, int64_t bytes);
+
+    static MemorySnapshot snapshot();
+
+    // Starts per-frame counting from the current totals. Call right before the first frame,
+    // otherwise everything allocated during startup is reported as frame 1.
+    static void beginFrameCounting();
+
+    // Closes the current frame's allocation counters and writes a JSON snapshot when one is due
+    static void endFrame(size_t shapeCount);
+
+    // Appends one JSON object per line to path every intervalSeconds
+    static bool startSnapshots(const std::string& path, double intervalSeconds = 1.0);
+
+    static void writeJson(std::ostream& os, const MemorySnapshot& snap, size_t shapeCount);
+};
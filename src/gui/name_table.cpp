@@ -0,0 +1,63 @@
+//========================================================================
+// Copyright (c) 2025 hung-truong
+
+#include "name_table.h"
+#include "memory_telemetry.h"
+
+#include <cstdio>
+
+NameTable& NameTable::global()
+{
+    static NameTable table;
+    return table;
+}
+
+NameId NameTable::intern(std::string_view text)
+{
+    auto it = lookup.find(text);
+    if (it != lookup.end()) {
+        return it->second;
+    }
+
+    MemoryScope scope(MemorySubsystem::Names);
+    NameId id = static_cast<NameId>(strings.size());
+    const std::string& stored = strings.emplace_back(text);
+    lookup.emplace(std::string_view(stored), id);
+    stringBytes += stored.size();
+    return id;
+}
+
+ShapeName NameTable::copyOf(const ShapeName& name)
+{
+    if (useCopyCounter) {
+        ShapeName copy = name;
+        if (copy.copyCount < UINT16_MAX) {
+            ++copy.copyCount;
+        }
+        return copy;
+    }
+    return makeName(toString(name) + " (Copy)");
+}
+
+void NameTable::format(const ShapeName& name, char* buffer, size_t bufferSize) const
+{
+    const char* base = str(name.base).c_str();
+    if (name.copyCount == 0) {
+        snprintf(buffer, bufferSize, "%s", base);
+    } else if (name.copyCount == 1) {
+        snprintf(buffer, bufferSize, "%s (Copy)", base);
+    } else {
+        snprintf(buffer, bufferSize, "%s (Copy %u)", base, static_cast<unsigned>(name.copyCount));
+    }
+}
+
+std::string NameTable::toString(const ShapeName& name) const
+{
+    std::string text = str(name.base);
+    if (name.copyCount == 1) {
+        text += " (Copy)";
+    } else if (name.copyCount > 1) {
+        text += " (Copy " + std::to_string(name.copyCount) + ")";
+    }
+    return text;
+}
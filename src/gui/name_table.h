@@ -0,0 +1,58 @@
+//========================================================================
+// Copyright (c) 2025 hung-truong
+// --- Interns shape names so shapes share one copy of each distinct string ---
+
+#pragma once
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+using NameId = uint32_t;
+
+// The name stored on every shape: an interned base string plus a copy counter.
+// "Rect (Copy) (Copy)" is stored as {"Rect", 2} when copy counters are enabled.
+struct ShapeName {
+    NameId base = 0;
+    uint16_t copyCount = 0;
+};
+
+class NameTable {
+private:
+    // std::deque never moves its elements, so the string_view keys below stay valid
+    std::deque<std::string> strings;
+    std::unordered_map<std::string_view, NameId> lookup;
+    size_t stringBytes = 0;
+    bool useCopyCounter = true;
+
+public:
+    NameTable() { intern(""); } // NameId 0 is always the empty name
+
+    // The table shared by all shapes of the editor
+    static NameTable& global();
+
+    // Returns the id of an existing equal string, or stores a new one
+    NameId intern(std::string_view text);
+
+    const std::string& str(NameId id) const { return strings[id]; }
+
+    ShapeName makeName(std::string_view text) { return ShapeName{intern(text), 0}; }
+
+    // Name for a copy of a shape. With copy counters only the counter is bumped,
+    // otherwise the full " (Copy)" suffixed string is interned.
+    ShapeName copyOf(const ShapeName& name);
+
+    // Writes the display form of a name into buffer (always null terminated)
+    void format(const ShapeName& name, char* buffer, size_t bufferSize) const;
+
+    std::string toString(const ShapeName& name) const;
+
+    bool copyCounterEnabled() const { return useCopyCounter; }
+    void setCopyCounterEnabled(bool enabled) { useCopyCounter = enabled; }
+
+    size_t size() const { return strings.size(); }
+
+    // Characters stored across all interned strings
+    size_t characterBytes() const { return stringBytes; }
+};
@@ -0,0 +1,60 @@
+//========================================================================
+// Copyright (c) 2025 hung-truong
+// --- Chunked parallel loops on the shared thread pool ---
+
+#pragma once
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <vector>
+
+// Calls body(begin, end) on contiguous chunks covering [0, count), at most one chunk per pool thread.
+// Chunks smaller than minChunk are not worth a handoff, so small inputs run inline on the caller.
+template<typename Body>
+void parallelFor(size_t count, size_t minChunk, Body&& body)
+{
+    ThreadPool& pool = ThreadPool::global();
+    const size_t chunkCount = std::clamp(count / std::max<size_t>(minChunk, 1), size_t(1), pool.concurrency());
+    if (chunkCount == 1) {
+        body(size_t(0), count);
+        return;
+    }
+
+    const size_t chunkSize = (count + chunkCount - 1) / chunkCount;
+    pool.run(chunkCount, [&](size_t chunk) {
+        const size_t begin = chunk * chunkSize;
+        const size_t end = std::min(count, begin + chunkSize);
+        if (begin < end) {
+            body(begin, end);
+        }
+    });
+}
+
+// Sorts chunks in parallel, then merges neighbouring runs pairwise until one run is left
+template<typename T, typename Compare>
+void parallelSort(std::vector<T>& values, Compare less, size_t minChunk = 16384)
+{
+    ThreadPool& pool = ThreadPool::global();
+    const size_t count = values.size();
+    const size_t chunkCount = std::clamp(count / std::max<size_t>(minChunk, 1), size_t(1), pool.concurrency());
+    const size_t chunkSize = (count + chunkCount - 1) / std::max<size_t>(chunkCount, 1);
+    if (chunkCount == 1) {
+        std::sort(values.begin(), values.end(), less);
+        return;
+    }
+
+    pool.run(chunkCount, [&](size_t chunk) {
+        const size_t begin = std::min(count, chunk * chunkSize);
+        const size_t end = std::min(count, begin + chunkSize);
+        std::sort(values.begin() + begin, values.begin() + end, less);
+    });
+    for (size_t width = chunkSize; width < count; width *= 2) {
+        const size_t pairs = (count + 2 * width - 1) / (2 * width);
+        pool.run(pairs, [&](size_t pair) {
+            const size_t begin = pair * 2 * width;
+            const size_t middle = std::min(count, begin + width);
+            const size_t end = std::min(count, begin + 2 * width);
+            std::inplace_merge(values.begin() + begin, values.begin() + middle, values.begin() + end, less);
+        });
+    }
+}
@@ -0,0 +1,124 @@
+//========================================================================
+// Copyright (c) 2025 hung-truong
+
+#pragma once
+#include "shape.h"
+#include "polygon_geometry.h"
+#include "memory_telemetry.h"
+
+// --- Base class for shapes made of an arbitrary vertex list ---
+// Vertices are stored relative to `position`, so moving the shape never touches the
+// cached triangulation or edge grid. Only changing a vertex invalidates them.
+class PathShape : public Shape {
+public:
+    const std::vector<ImVec2>& getPoints() const { return points; }
+
+    void setPoints(std::vector<ImVec2> newPoints) {
+        points = std::move(newPoints);
+        geometryDirty = true;
+    }
+
+    void setPoint(size_t index, ImVec2 point) {
+        points[index] = point;
+        geometryDirty = true;
+    }
+
+    size_t vertexCount() const { return points.size(); }
+
+    // Number of triangles in the cached draw mesh
+    size_t triangleCount() const {
+        ensureGeometry();
+        return meshIndices.size() / 3;
+    }
+
+    void getBounds(ImVec2& bounds_min, ImVec2& bounds_max) const override {
+        ensureGeometry();
+        bounds_min = ImVec2(position.x + edgeGrid.min().x, position.y + edgeGrid.min().y);
+        bounds_max = ImVec2(position.x + edgeGrid.max().x, position.y + edgeGrid.max().y);
+    }
+
+    // Uniform scaling keeps the triangulation and edge grid valid, so the caches are scaled
+    // in place instead of being rebuilt
+    void scale(float factor) override {
+        for (ImVec2& p : points) {
+            p = ImVec2(p.x * factor, p.y * factor);
+        }
+        if (!geometryDirty) {
+            for (ImVec2& v : meshVertices) {
+                v = ImVec2(v.x * factor, v.y * factor);
+            }
+            edgeGrid.scale(factor);
+        }
+        onScaled(factor);
+    }
+
+    void clampPosition(const ImVec2& canvas_size) override {
+        ensureGeometry();
+        ImVec2 newPosition = ImVec2(
+            position.x + ImGui::GetIO().MouseDelta.x,
+            position.y + ImGui::GetIO().MouseDelta.y
+        );
+        // Keep the vertex bounding box inside the canvas
+        const ImVec2 localMin = edgeGrid.min();
+        const ImVec2 localMax = edgeGrid.max();
+        position.x = std::max(-localMin.x, std::min(canvas_size.x - localMax.x, newPosition.x));
+        position.y = std::max(-localMin.y, std::min(canvas_size.y - localMax.y, newPosition.y));
+    }
+
+protected:
+    std::vector<ImVec2> points;
+    bool closed;
+
+    // Derived data, rebuilt lazily on the first use after a vertex change
+    mutable bool geometryDirty = true;
+    mutable EdgeGrid edgeGrid;
+    mutable std::vector<ImVec2> meshVertices; // Local space, filled by rebuildMesh()
+    mutable std::vector<uint32_t> meshIndices;
+
+    PathShape(ImVec2 pos, std::vector<ImVec2> pts, bool isClosed, const std::array<float, 3>& col, ShapeName n)
+        : Shape(pos, col, n), points(std::move(pts)), closed(isClosed) {}
+
+    // Fills meshVertices / meshIndices from `points`
+    virtual void rebuildMesh() const = 0;
+
+    // Lets derived shapes scale their own parameters along with the vertices
+    virtual void onScaled(float) {}
+
+    void invalidateMesh() { geometryDirty = true; }
+
+    void ensureGeometry() const {
+        if (!geometryDirty) return;
+        MemoryScope scope(MemorySubsystem::SceneStorage);
+        edgeGrid.build(points, closed);
+        rebuildMesh();
+        geometryDirty = false;
+    }
+
+    // Writes the cached mesh straight into the draw list; only the vertex offset changes per frame
+    void drawMesh(ImDrawList* draw_list, ImVec2 offset) const {
+        ensureGeometry();
+        if (meshIndices.empty()) return;
+
+        // 16-bit indices cannot address a bigger mesh in one reservation, fall back to plain triangles
+        if (sizeof(ImDrawIdx) == 2 && meshVertices.size() > 0xFFFF) {
+            for (size_t k = 0; k + 2 < meshIndices.size(); k += 3) {
+                const ImVec2& a = meshVertices[meshIndices[k]];
+                const ImVec2& b = meshVertices[meshIndices[k + 1]];
+                const ImVec2& c = meshVertices[meshIndices[k + 2]];
+                draw_list->AddTriangleFilled(ImVec2(a.x + offset.x, a.y + offset.y), ImVec2(b.x + offset.x, b.y + offset.y),
+                                             ImVec2(c.x + offset.x, c.y + offset.y), packedColor);
+            }
+            return;
+        }
+
+        draw_list->PrimReserve(static_cast<int>(meshIndices.size()), static_cast<int>(meshVertices.size()));
+        const ImVec2 uv = ImGui::GetFontTexUvWhitePixel();
+        const unsigned int base = draw_list->_VtxCurrentIdx; // Read after PrimReserve, which may start a new vertex range
+        for (const ImVec2& v : meshVertices) {
+            draw_list->PrimWriteVtx(ImVec2(v.x + offset.x, v.y + offset.y), uv, packedColor);
+        }
+        for (uint32_t index : meshIndices) {
+            draw_list->PrimWriteIdx(static_cast<ImDrawIdx>(base + index));
+        }
+    }
+};
@@ -0,0 +1,60 @@
+//========================================================================
+// Copyright (c) 2025 hung-truong
+
+#pragma once
+#include "path_shape.h"
+class PolygonShape : public PathShape {
+public:
+    PolygonShape(ImVec2 pos, std::vector<ImVec2> pts, const std::array<float, 3>& col, std::string_view n = "Polygon")
+        : PathShape(pos, std::move(pts), true, col, NameTable::global().makeName(n)) {}
+
+    PolygonShape(ImVec2 pos, std::vector<ImVec2> pts, const std::array<float, 3>& col, ShapeName n)
+        : PathShape(pos, std::move(pts), true, col, n) {}
+
+    // Star outline around the origin, alternating between radius and half radius
+    static std::vector<ImVec2> makeStar(int vertexCount, float radius) {
+        std::vector<ImVec2> star;
+        star.reserve(vertexCount);
+        for (int i = 0; i < vertexCount; ++i) {
+            float angle = 2.0f * 3.14159265f * i / vertexCount;
+            float r = (i % 2 == 0) ? radius : radius * 0.5f;
+            star.emplace_back(r * std::cos(angle), r * std::sin(angle));
+        }
+        return star;
+    }
+
+    // Override draw function for PolygonShape
+    void draw(ImDrawList* draw_list, ImVec2 canvas_origin_screen_pos) const override {
+        ImVec2 offset = ImVec2(canvas_origin_screen_pos.x + position.x, canvas_origin_screen_pos.y + position.y);
+        drawMesh(draw_list, offset);
+        // Draw a border if selected
+        if (isSelected) {
+            // Built in the draw list's own path buffer, no per-frame allocation
+            for (const ImVec2& p : points) {
+                draw_list->PathLineTo(ImVec2(p.x + offset.x, p.y + offset.y));
+            }
+            draw_list->PathStroke(IM_COL32(255, 255, 0, 255), ImDrawFlags_Closed, 2.0f); // Yellow border
+        }
+    }
+
+    // Override contains function for PolygonShape, uses the cached edge grid
+    bool contains(ImVec2 point_in_canvas_coords) const override {
+        ensureGeometry();
+        return edgeGrid.containsPoint(points, ImVec2(point_in_canvas_coords.x - position.x, point_in_canvas_coords.y - position.y));
+    }
+
+    const char* typeName() const override { return "Polygon"; }
+
+    //Override function for cloning, the cached triangulation is copied along
+    std::unique_ptr<Shape> clone() const override {
+        auto copy = std::make_unique<PolygonShape>(*this);
+        copy->isSelected = false;
+        return copy;
+    }
+
+protected:
+    void rebuildMesh() const override {
+        meshVertices = points;
+        meshIndices = PolygonGeometry::triangulate(points);
+    }
+};
@@ -0,0 +1,232 @@
+//========================================================================
+// Copyright (c) 2025 hung-truong
+
+#include "polygon_geometry.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    float cross(ImVec2 a, ImVec2 b, ImVec2 c) {
+        return (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+    }
+
+    // Inclusive test in the polygon's winding direction (orient is +1 or -1)
+    bool pointInTriangle(ImVec2 p, ImVec2 a, ImVec2 b, ImVec2 c, float orient) {
+        return cross(a, b, p) * orient >= 0.0f &&
+               cross(b, c, p) * orient >= 0.0f &&
+               cross(c, a, p) * orient >= 0.0f;
+    }
+
+    bool samePoint(ImVec2 a, ImVec2 b) {
+        return a.x == b.x && a.y == b.y;
+    }
+}
+
+float PolygonGeometry::signedArea2(const std::vector<ImVec2>& points)
+{
+    float area = 0.0f;
+    for (size_t i = 0, j = points.size() - 1; i < points.size(); j = i++) {
+        area += points[j].x * points[i].y - points[i].x * points[j].y;
+    }
+    return area;
+}
+
+std::vector<uint32_t> PolygonGeometry::triangulate(const std::vector<ImVec2>& points)
+{
+    std::vector<uint32_t> triangles;
+    const uint32_t n = static_cast<uint32_t>(points.size());
+    if (n < 3) return triangles;
+    triangles.reserve((n - 2) * 3);
+
+    // Convexity is judged relative to the outline's own winding so either order works
+    const float orient = signedArea2(points) >= 0.0f ? 1.0f : -1.0f;
+
+    // Remaining outline as a circular doubly linked list over the original indices
+    std::vector<uint32_t> prev(n), next(n);
+    for (uint32_t i = 0; i < n; ++i) {
+        prev[i] = (i + n - 1) % n;
+        next[i] = (i + 1) % n;
+    }
+    // Reflex (or collinear) vertices are never ears, and only they can block an ear
+    std::vector<char> reflex(n);
+    auto updateReflex = [&](uint32_t i) {
+        reflex[i] = cross(points[prev[i]], points[i], points[next[i]]) * orient <= 0.0f;
+    };
+    for (uint32_t i = 0; i < n; ++i) updateReflex(i);
+
+    auto isEar = [&](uint32_t i) {
+        if (reflex[i]) return false;
+        const uint32_t a = prev[i], c = next[i];
+        for (uint32_t j = next[c]; j != a; j = next[j]) {
+            if (!reflex[j]) continue;
+            const ImVec2 p = points[j];
+            if (samePoint(p, points[a]) || samePoint(p, points[i]) || samePoint(p, points[c])) continue;
+            if (pointInTriangle(p, points[a], points[i], points[c], orient)) return false;
+        }
+        return true;
+    };
+    auto clip = [&](uint32_t i) {
+        const uint32_t a = prev[i], c = next[i];
+        triangles.push_back(a);
+        triangles.push_back(i);
+        triangles.push_back(c);
+        next[a] = c;
+        prev[c] = a;
+        updateReflex(a);
+        updateReflex(c);
+    };
+
+    uint32_t remaining = n;
+    uint32_t current = 0;
+    uint32_t stalled = 0; // Vertices visited since the last clip
+    while (remaining > 3) {
+        if (isEar(current)) {
+            const uint32_t after = prev[current]; // Clipping can turn the neighbour into an ear
+            clip(current);
+            current = after;
+            --remaining;
+            stalled = 0;
+        } else if (++stalled > remaining) {
+            // No ear left: the outline is degenerate or self-intersecting, force progress
+            const uint32_t after = next[current];
+            clip(current);
+            current = after;
+            --remaining;
+            stalled = 0;
+        } else {
+            current = next[current];
+        }
+    }
+    triangles.push_back(prev[current]);
+    triangles.push_back(current);
+    triangles.push_back(next[current]);
+    return triangles;
+}
+
+float PolygonGeometry::distanceToSegmentSq(ImVec2 p, ImVec2 a, ImVec2 b)
+{
+    const float abx = b.x - a.x, aby = b.y - a.y;
+    const float lengthSq = abx * abx + aby * aby;
+    float t = lengthSq > 0.0f ? ((p.x - a.x) * abx + (p.y - a.y) * aby) / lengthSq : 0.0f;
+    t = std::clamp(t, 0.0f, 1.0f);
+    const float dx = a.x + abx * t - p.x, dy = a.y + aby * t - p.y;
+    return dx * dx + dy * dy;
+}
+
+int EdgeGrid::cellColumn(float x) const
+{
+    return std::clamp(static_cast<int>((x - boundsMin.x) / cellSize.x), 0, columns - 1);
+}
+
+int EdgeGrid::cellRow(float y) const
+{
+    return std::clamp(static_cast<int>((y - boundsMin.y) / cellSize.y), 0, rows - 1);
+}
+
+void EdgeGrid::build(const std::vector<ImVec2>& points, bool closed)
+{
+    cellStart.clear();
+    edgeIndices.clear();
+    columns = rows = 0;
+    if (points.empty()) return;
+
+    boundsMin = boundsMax = points[0];
+    for (const ImVec2& p : points) {
+        boundsMin.x = std::min(boundsMin.x, p.x);
+        boundsMin.y = std::min(boundsMin.y, p.y);
+        boundsMax.x = std::max(boundsMax.x, p.x);
+        boundsMax.y = std::max(boundsMax.y, p.y);
+    }
+
+    const size_t edgeCount = closed ? points.size() : points.size() - 1;
+    if (edgeCount == 0) return;
+
+    // Aim for about one edge per cell, keeping cells roughly square
+    const float width = std::max(boundsMax.x - boundsMin.x, 1.0f);
+    const float height = std::max(boundsMax.y - boundsMin.y, 1.0f);
+    const float cellsPerUnit = std::sqrt(static_cast<float>(edgeCount) / (width * height));
+    columns = std::clamp(static_cast<int>(std::ceil(width * cellsPerUnit)), 1, 256);
+    rows = std::clamp(static_cast<int>(std::ceil(height * cellsPerUnit)), 1, 256);
+    cellSize = ImVec2(width / columns, height / rows);
+
+    // Two passes (count, then fill) so the cell lists live in one flat array
+    auto forEachEdgeCell = [&](auto&& visit) {
+        for (size_t e = 0; e < edgeCount; ++e) {
+            const ImVec2 a = points[e], b = points[(e + 1) % points.size()];
+            const int c0 = cellColumn(std::min(a.x, b.x)), c1 = cellColumn(std::max(a.x, b.x));
+            const int r0 = cellRow(std::min(a.y, b.y)), r1 = cellRow(std::max(a.y, b.y));
+            for (int r = r0; r <= r1; ++r) {
+                for (int c = c0; c <= c1; ++c) {
+                    visit(r * columns + c, static_cast<uint32_t>(e));
+                }
+            }
+        }
+    };
+
+    cellStart.assign(static_cast<size_t>(columns) * rows + 1, 0);
+    forEachEdgeCell([&](int cell, uint32_t) { ++cellStart[cell + 1]; });
+    for (size_t c = 1; c < cellStart.size(); ++c) {
+        cellStart[c] += cellStart[c - 1];
+    }
+    edgeIndices.resize(cellStart.back());
+    std::vector<uint32_t> fill(cellStart.begin(), cellStart.end() - 1);
+    forEachEdgeCell([&](int cell, uint32_t edge) { edgeIndices[fill[cell]++] = edge; });
+}
+
+void EdgeGrid::scale(float factor)
+{
+    boundsMin = ImVec2(boundsMin.x * factor, boundsMin.y * factor);
+    boundsMax = ImVec2(boundsMax.x * factor, boundsMax.y * factor);
+    cellSize = ImVec2(cellSize.x * factor, cellSize.y * factor);
+}
+
+bool EdgeGrid::containsPoint(const std::vector<ImVec2>& points, ImVec2 p) const
+{
+    if (columns == 0) return false;
+    if (p.x < boundsMin.x || p.x > boundsMax.x || p.y < boundsMin.y || p.y > boundsMax.y) return false;
+
+    // Cast a ray towards +x. An edge can sit in several cells of the row, so a crossing
+    // is only counted in the cell that contains its intersection point.
+    const int row = cellRow(p.y);
+    const size_t n = points.size();
+    bool inside = false;
+    for (int column = cellColumn(p.x); column < columns; ++column) {
+        const int cell = row * columns + column;
+        for (uint32_t k = cellStart[cell]; k < cellStart[cell + 1]; ++k) {
+            const uint32_t e = edgeIndices[k];
+            const ImVec2 a = points[e], b = points[(e + 1) % n];
+            if ((a.y > p.y) == (b.y > p.y)) continue;
+            const float x = a.x + (p.y - a.y) * (b.x - a.x) / (b.y - a.y);
+            if (x > p.x && cellColumn(x) == column) {
+                inside = !inside;
+            }
+        }
+    }
+    return inside;
+}
+
+bool EdgeGrid::isNearEdge(const std::vector<ImVec2>& points, bool closed, ImVec2 p, float radius) const
+{
+    if (columns == 0) return false;
+    if (p.x < boundsMin.x - radius || p.x > boundsMax.x + radius ||
+        p.y < boundsMin.y - radius || p.y > boundsMax.y + radius) return false;
+
+    const size_t n = points.size();
+    const float radiusSq = radius * radius;
+    const int c0 = cellColumn(p.x - radius), c1 = cellColumn(p.x + radius);
+    const int r0 = cellRow(p.y - radius), r1 = cellRow(p.y + radius);
+    for (int r = r0; r <= r1; ++r) {
+        for (int c = c0; c <= c1; ++c) {
+            const int cell = r * columns + c;
+            for (uint32_t k = cellStart[cell]; k < cellStart[cell + 1]; ++k) {
+                const uint32_t e = edgeIndices[k];
+                if (!closed && e + 1 >= n) continue;
+                if (PolygonGeometry::distanceToSegmentSq(p, points[e], points[(e + 1) % n]) <= radiusSq) {
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
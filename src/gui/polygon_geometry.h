@@ -0,0 +1,52 @@
+//========================================================================
+// Copyright (c) 2025 hung-truong
+// --- Triangulation and edge lookup for shapes with many vertices ---
+
+#pragma once
+#include <imgui.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace PolygonGeometry {
+    // Twice the signed area of a closed outline, the sign gives the winding order
+    float signedArea2(const std::vector<ImVec2>& points);
+
+    // Ear-clipping triangulation of a simple polygon, three vertex indices per triangle.
+    // Self-intersecting input still terminates and returns a best-effort fan for the leftovers.
+    std::vector<uint32_t> triangulate(const std::vector<ImVec2>& points);
+
+    float distanceToSegmentSq(ImVec2 p, ImVec2 a, ImVec2 b);
+}
+
+// Uniform grid over a shape's bounds; each cell lists the edges whose bounding box overlaps it.
+// Edge i runs from points[i] to points[i + 1] (wrapping to points[0] for closed outlines).
+class EdgeGrid {
+private:
+    ImVec2 boundsMin;
+    ImVec2 boundsMax;
+    ImVec2 cellSize;
+    int columns = 0;
+    int rows = 0;
+    // Compressed rows: edges of cell c are edgeIndices[cellStart[c] .. cellStart[c + 1])
+    std::vector<uint32_t> cellStart;
+    std::vector<uint32_t> edgeIndices;
+
+    int cellColumn(float x) const;
+    int cellRow(float y) const;
+
+public:
+    void build(const std::vector<ImVec2>& points, bool closed);
+
+    // Even-odd point-in-polygon test that only visits the cells right of the point
+    bool containsPoint(const std::vector<ImVec2>& points, ImVec2 p) const;
+
+    // True when p lies within `radius` of any edge
+    bool isNearEdge(const std::vector<ImVec2>& points, bool closed, ImVec2 p, float radius) const;
+
+    // Scales the grid about the local origin; cell assignment is unchanged, so no rebuild is needed
+    void scale(float factor);
+
+    ImVec2 min() const { return boundsMin; }
+    ImVec2 max() const { return boundsMax; }
+};
@@ -0,0 +1,94 @@
+//========================================================================
+// Copyright (c) 2025 hung-truong
+
+#pragma once
+#include "path_shape.h"
+class PolylineShape : public PathShape {
+public:
+    PolylineShape(ImVec2 pos, std::vector<ImVec2> pts, const std::array<float, 3>& col, std::string_view n = "Polyline")
+        : PathShape(pos, std::move(pts), false, col, NameTable::global().makeName(n)) {}
+
+    PolylineShape(ImVec2 pos, std::vector<ImVec2> pts, const std::array<float, 3>& col, ShapeName n)
+        : PathShape(pos, std::move(pts), false, col, n) {}
+
+    float getThickness() const { return thickness; }
+
+    void setThickness(float t) {
+        thickness = t;
+        invalidateMesh();
+    }
+
+    // Sine wave starting at the origin, `length` wide
+    static std::vector<ImVec2> makeWave(int vertexCount, float length, float amplitude) {
+        std::vector<ImVec2> wave;
+        wave.reserve(vertexCount);
+        for (int i = 0; i < vertexCount; ++i) {
+            float t = (vertexCount > 1) ? static_cast<float>(i) / (vertexCount - 1) : 0.0f;
+            wave.emplace_back(t * length, amplitude * std::sin(t * 6.0f * 3.14159265f));
+        }
+        return wave;
+    }
+
+    // Override draw function for PolylineShape
+    void draw(ImDrawList* draw_list, ImVec2 canvas_origin_screen_pos) const override {
+        ImVec2 offset = ImVec2(canvas_origin_screen_pos.x + position.x, canvas_origin_screen_pos.y + position.y);
+        drawMesh(draw_list, offset);
+        // Draw a bounding box if selected
+        if (isSelected) {
+            ImVec2 p_min = ImVec2(offset.x + edgeGrid.min().x - thickness, offset.y + edgeGrid.min().y - thickness);
+            ImVec2 p_max = ImVec2(offset.x + edgeGrid.max().x + thickness, offset.y + edgeGrid.max().y + thickness);
+            draw_list->AddRect(p_min, p_max, IM_COL32(255, 255, 0, 255), 0, 0, 2.0f); // Yellow border
+        }
+    }
+
+    // Override contains function for PolylineShape: within a few pixels of the stroke
+    bool contains(ImVec2 point_in_canvas_coords) const override {
+        ensureGeometry();
+        ImVec2 local = ImVec2(point_in_canvas_coords.x - position.x, point_in_canvas_coords.y - position.y);
+        return edgeGrid.isNearEdge(points, false, local, thickness * 0.5f + 2.0f);
+    }
+
+    const char* typeName() const override { return "Polyline"; }
+
+    //Override function for cloning, the cached stroke mesh is copied along
+    std::unique_ptr<Shape> clone() const override {
+        auto copy = std::make_unique<PolylineShape>(*this);
+        copy->isSelected = false;
+        return copy;
+    }
+
+protected:
+    float thickness = 2.0f;
+
+    // The cached stroke mesh was scaled too, keep its thickness consistent with it
+    void onScaled(float factor) override {
+        thickness *= factor;
+    }
+
+    // One quad per segment, built once instead of letting ImGui tessellate the stroke every frame
+    void rebuildMesh() const override {
+        meshVertices.clear();
+        meshIndices.clear();
+        if (points.size() < 2) return;
+        meshVertices.reserve((points.size() - 1) * 4);
+        meshIndices.reserve((points.size() - 1) * 6);
+
+        const float half = thickness * 0.5f;
+        for (size_t i = 0; i + 1 < points.size(); ++i) {
+            const ImVec2 a = points[i], b = points[i + 1];
+            const float dx = b.x - a.x, dy = b.y - a.y;
+            const float length = std::sqrt(dx * dx + dy * dy);
+            if (length <= 0.0f) continue;
+            const ImVec2 normal = ImVec2(-dy / length * half, dx / length * half);
+
+            const uint32_t base = static_cast<uint32_t>(meshVertices.size());
+            meshVertices.emplace_back(a.x + normal.x, a.y + normal.y);
+            meshVertices.emplace_back(b.x + normal.x, b.y + normal.y);
+            meshVertices.emplace_back(b.x - normal.x, b.y - normal.y);
+            meshVertices.emplace_back(a.x - normal.x, a.y - normal.y);
+            for (uint32_t corner : {0u, 1u, 2u, 0u, 2u, 3u}) {
+                meshIndices.push_back(base + corner);
+            }
+        }
+    }
+};
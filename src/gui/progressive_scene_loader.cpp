@@ -0,0 +1,61 @@
+//========================================================================
+// Copyright (c) 2025 hung-truong
+
+#include "progressive_scene_loader.h"
+
+#include <algorithm>
+#include <chrono>
+
+void ProgressiveSceneLoader::start(ShapeSource newSource, size_t expected)
+{
+    source = std::move(newSource);
+    expectedCount = expected;
+    loadedCount = 0;
+}
+
+size_t ProgressiveSceneLoader::loadChunk(std::vector<std::unique_ptr<Shape>>& scene, double budgetMs)
+{
+    if (!source) return 0;
+
+    const auto deadline = std::chrono::steady_clock::now() +
+                          std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                              std::chrono::duration<double, std::milli>(budgetMs));
+    size_t added = 0;
+    while (true) {
+        for (int i = 0; i < ClockCheckInterval; ++i) {
+            std::unique_ptr<Shape> shape = source();
+            if (!shape) {
+                source = nullptr; // Scene fully loaded
+                return added;
+            }
+            scene.push_back(std::move(shape));
+            ++added;
+            ++loadedCount;
+        }
+        if (budgetMs >= 0.0 && std::chrono::steady_clock::now() >= deadline) {
+            return added;
+        }
+    }
+}
+
+size_t ProgressiveSceneLoader::loadCount(std::vector<std::unique_ptr<Shape>>& scene, size_t count)
+{
+    size_t added = 0;
+    while (source && added < count) {
+        std::unique_ptr<Shape> shape = source();
+        if (!shape) {
+            source = nullptr; // Scene fully loaded
+            break;
+        }
+        scene.push_back(std::move(shape));
+        ++added;
+        ++loadedCount;
+    }
+    return added;
+}
+
+float ProgressiveSceneLoader::progress() const
+{
+    if (expectedCount == 0) return 0.0f;
+    return std::min(1.0f, static_cast<float>(loadedCount) / static_cast<float>(expectedCount));
+}
@@ -0,0 +1,47 @@
+//========================================================================
+// Copyright (c) 2025 hung-truong
+// --- Adds a large scene to the canvas in small, time-budgeted chunks ---
+
+#pragma once
+#include "shape.h"
+
+#include <functional>
+
+// Produces the next shape of a scene, or nullptr once the scene is exhausted.
+// Creation (parsing, generation) happens inside the source so it is budgeted too.
+using ShapeSource = std::function<std::unique_ptr<Shape>()>;
+
+class ProgressiveSceneLoader {
+private:
+    ShapeSource source;
+    size_t expectedCount = 0; // 0 when the source size is unknown
+    size_t loadedCount = 0;
+
+    // Reading the clock per shape would cost more than inserting it
+    static constexpr int ClockCheckInterval = 64;
+
+public:
+    // Starts loading a new scene, replacing any scene still in progress
+    void start(ShapeSource newSource, size_t expected = 0);
+
+    // Moves shapes from the source into the scene until budgetMs has elapsed or the source runs dry.
+    // A negative budget drains the whole source. Returns the number of shapes added.
+    size_t loadChunk(std::vector<std::unique_ptr<Shape>>& scene, double budgetMs);
+
+    // Moves exactly `count` shapes, fewer only if the source runs dry. Replay uses this to
+    // reproduce the chunk sizes of a recorded session independently of the machine's speed.
+    // It never probes the source past the last shape, so call finish() where the live run did.
+    size_t loadCount(std::vector<std::unique_ptr<Shape>>& scene, size_t count);
+
+    // Ends the current scene; shapes the source has not produced yet are dropped
+    void finish() { source = nullptr; }
+
+    bool isLoading() const { return static_cast<bool>(source); }
+
+    size_t loaded() const { return loadedCount; }
+
+    size_t expected() const { return expectedCount; }
+
+    // Fraction of the scene loaded so far, 0 when the expected size is unknown
+    float progress() const;
+};
@@ -7,7 +7,10 @@ class RectangleShape : public Shape {
 public:
     ImVec2 size;
 
-    RectangleShape(ImVec2 pos, ImVec2 s, const std::array<float, 3>& col, const std::string& n = "Rectangle")
+    RectangleShape(ImVec2 pos, ImVec2 s, const std::array<float, 3>& col, std::string_view n = "Rectangle")
+        : Shape(pos, col, n), size(s) {}
+
+    RectangleShape(ImVec2 pos, ImVec2 s, const std::array<float, 3>& col, ShapeName n)
         : Shape(pos, col, n), size(s) {}
 
     // Override draw function for RectangleShape
@@ -15,13 +18,7 @@ public:
         // Calculate absolute screen positions for drawing
         ImVec2 p_min_screen = ImVec2(canvas_origin_screen_pos.x + position.x, canvas_origin_screen_pos.y + position.y);
         ImVec2 p_max_screen = ImVec2(p_min_screen.x + size.x, p_min_screen.y + size.y);
-        ImU32 drawColor = IM_COL32(
-            (int)(color[0] * 255),
-            (int)(color[1] * 255),
-            (int)(color[2] * 255),
-            255
-        );        
-        draw_list->AddRectFilled(p_min_screen, p_max_screen, drawColor);
+        draw_list->AddRectFilled(p_min_screen, p_max_screen, packedColor);
         // Draw a border if selected
         if (isSelected) {
             draw_list->AddRect(p_min_screen, p_max_screen, IM_COL32(255, 255, 0, 255), 0, 2.0f); // Yellow border
@@ -34,6 +31,17 @@ public:
                point_in_canvas_coords.y >= position.y && point_in_canvas_coords.y <= (position.y + size.y);
     }
 
+    const char* typeName() const override { return "Rect"; }
+
+    void getBounds(ImVec2& bounds_min, ImVec2& bounds_max) const override {
+        bounds_min = position;
+        bounds_max = ImVec2(position.x + size.x, position.y + size.y);
+    }
+
+    void scale(float factor) override {
+        size = ImVec2(size.x * factor, size.y * factor);
+    }
+
     void clampPosition(const ImVec2& canvas_size) override {
 
         ImVec2 newPosition = ImVec2(
@@ -14,8 +14,11 @@
 #include <string>
 #include <cmath> // For M_PI if needed, or define it
 #include <memory> // For std::unique_ptr
+#include <algorithm> // For std::min / std::max in clampToCanvas
 #include <cstdio> // For sprintf
 
+#include "name_table.h"
+
 // Cross-platform OpenGL loader
 #ifdef _WIN32
 // For window build as MSVC is stricter than GCC or CLANG
@@ -45,14 +48,60 @@ public:
     // Pure virtual function for clamping a shape object position to be within the canvas
     virtual void clampPosition(const ImVec2& canvas_size) = 0;
 
+    // Short type label shown in the shape list
+    virtual const char* typeName() const = 0;
+
+    // Axis-aligned bounding box in canvas-local coordinates
+    virtual void getBounds(ImVec2& bounds_min, ImVec2& bounds_max) const = 0;
+
+    // Scales the shape's extent (radius, size, vertices) by a positive factor, keeping its position
+    virtual void scale(float factor) = 0;
+
+    // Moves the shape the least amount needed to bring its bounds inside the canvas.
+    // Unlike clampPosition() it does not read ImGui input, so it is safe to call from worker threads.
+    void clampToCanvas(const ImVec2& canvas_size) {
+        ImVec2 bounds_min, bounds_max;
+        getBounds(bounds_min, bounds_max);
+        // The top-left corner wins when the shape is larger than the canvas, like clampPosition()
+        float dx = std::min(0.0f, canvas_size.x - bounds_max.x);
+        float dy = std::min(0.0f, canvas_size.y - bounds_max.y);
+        dx = std::max(dx, -bounds_min.x);
+        dy = std::max(dy, -bounds_min.y);
+        position.x += dx;
+        position.y += dy;
+    }
+
+
+    // Converts an editable RGB color to the packed form used by the draw list
+    static ImU32 packColor(const std::array<float, 3>& col) {
+        return IM_COL32(
+            (int)(col[0] * 255),
+            (int)(col[1] * 255),
+            (int)(col[2] * 255),
+            255
+        );
+    }
+
+    // Must be called after writing `color` directly (e.g. through ImGui::ColorEdit3)
+    void updatePackedColor() { packedColor = packColor(color); }
+
+    void setColor(const std::array<float, 3>& col) {
+        color = col;
+        updatePackedColor();
+    }
 
     // Common properties for all shapes
     ImVec2 position; // Position is now relative to the canvas's top-left corner
-    std::array<float, 3> color;
+    std::array<float, 3> color; // Editable RGB, keep packedColor in sync when changing it
+    ImU32 packedColor;          // `color` pre-converted for drawing
+    ShapeName name;             // Interned in NameTable::global()
     bool isSelected = false;
-    std::string name;
 
-    Shape(ImVec2 pos, const std::array<float, 3>& col, const std::string& n = "Shape")
-        : position(pos), color(col), name(n) {
+    Shape(ImVec2 pos, const std::array<float, 3>& col, ShapeName n)
+        : position(pos), color(col), packedColor(packColor(col)), name(n) {
+        }
+
+    Shape(ImVec2 pos, const std::array<float, 3>& col, std::string_view n = "Shape")
+        : Shape(pos, col, NameTable::global().makeName(n)) {
         }
 };
\ No newline at end of file
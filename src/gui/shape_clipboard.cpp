@@ -1,4 +1,5 @@
 #include "shape_clipboard.h"
+#include "memory_telemetry.h"
 
 void ShapeClipboard::copyShape(const Shape* shape) {
     if (!shape) {
@@ -7,6 +8,7 @@ void ShapeClipboard::copyShape(const Shape* shape) {
         return;
     }
     // Use the virtual clone() method to create a deep copy
+    MemoryScope scope(MemorySubsystem::Clipboard);
     clipboardShape = shape->clone();
 }
 
@@ -29,7 +31,7 @@ std::unique_ptr<Shape> ShapeClipboard::createPastedShape(const ImVec2& offset) c
     // Adjust its position and name
     newShape->position.x += offset.x;
     newShape->position.y += offset.y;
-    newShape->name += " (Copy)";
+    newShape->name = NameTable::global().copyOf(newShape->name);
 
     return newShape;
 }
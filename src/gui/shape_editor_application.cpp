@@ -3,8 +3,38 @@
 
 #include "shape_editor_application.h"
 
+#include <chrono>
+#include <random>
+
+namespace {
+    // Deterministic pseudo-random scene of circles and rectangles, created lazily one shape at a time
+    ShapeSource makeGeneratedSceneSource(size_t count, uint32_t seed)
+    {
+        return [index = size_t(0), count, rng = std::mt19937(seed)]() mutable -> std::unique_ptr<Shape> {
+            if (index >= count) {
+                return nullptr;
+            }
+            std::uniform_real_distribution<float> posX(0.0f, 900.0f);
+            std::uniform_real_distribution<float> posY(0.0f, 550.0f);
+            std::uniform_real_distribution<float> extent(2.0f, 20.0f);
+            std::uniform_real_distribution<float> channel(0.2f, 1.0f);
+
+            const std::array<float, 3> color = {channel(rng), channel(rng), channel(rng)};
+            const ImVec2 pos(posX(rng), posY(rng));
+            const bool isCircle = (index++ % 2) == 0;
+            if (isCircle) {
+                return std::make_unique<CircleShape>(pos, extent(rng), color, "Generated Circle");
+            }
+            const float w = extent(rng) * 2.0f;
+            const float h = extent(rng) * 2.0f;
+            return std::make_unique<RectangleShape>(pos, ImVec2(w, h), color, "Generated Rect");
+        };
+    }
+}
+
 bool ShapeEditorApplication::initialize()
 {
+    startupTimer.start();
     if (!glfwInit()) {
         std::cerr << "Failed to initialize GLFW" << std::endl;
         return false;
@@ -31,6 +61,7 @@ bool ShapeEditorApplication::initialize()
 
     glfwMakeContextCurrent(window);
     glfwSwapInterval(1); // Enable vsync
+    startupTimer.mark("GLFW init + window");
 
 #ifdef __APPLE__
     // TBD
@@ -40,9 +71,26 @@ bool ShapeEditorApplication::initialize()
         return false;
     }
 #endif
+    startupTimer.mark("gl3w init");
 
     IMGUI_CHECKVERSION();
+    MemoryTelemetry::installImGuiAllocator();
     ImGui::CreateContext();
+    setupImGuiStyle();
+
+    ImGui_ImplGlfw_InitForOpenGL(window, true);
+    ImGui_ImplOpenGL3_Init("#version 330");
+    startupTimer.mark("ImGui init");
+
+    // Build the atlas here so its cost is reported on its own; the GL upload happens in the first frame
+    ImGui::GetIO().Fonts->Build();
+    startupTimer.mark("Font atlas build");
+
+    return true;
+}
+
+void ShapeEditorApplication::setupImGuiStyle()
+{
     ImGuiIO& io = ImGui::GetIO();
     io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;
 
@@ -90,25 +138,50 @@ bool ShapeEditorApplication::initialize()
     style.Colors[ImGuiCol_NavWindowingHighlight] = ImVec4(1.00f, 1.00f, 1.00f, 0.70f);
     style.Colors[ImGuiCol_NavWindowingDimBg] = ImVec4(0.80f, 0.80f, 0.80f, 0.20f);
     style.Colors[ImGuiCol_ModalWindowDimBg] = ImVec4(0.80f, 0.80f, 0.80f, 0.35f);
+}
 
-    ImGui_ImplGlfw_InitForOpenGL(window, true);
-    ImGui_ImplOpenGL3_Init("#version 330");
-
+bool ShapeEditorApplication::startRecording(const std::string& path)
+{
+    if (!inputRecorder.start(path, generatedScene)) {
+        std::cerr << "Failed to open input log for recording: " << path << std::endl;
+        return false;
+    }
+    // Replay starts without an imgui.ini, so the recorded run must too or windows and table
+    // columns would sit elsewhere and recorded clicks would land on different widgets
+    ImGui::GetIO().IniFilename = nullptr;
     return true;
 }
 
+void ShapeEditorApplication::generateScene(size_t count, uint32_t seed)
+{
+    editorGUI.loadScene(makeGeneratedSceneSource(count, seed), count);
+    generatedScene.generatedShapes = count;
+    generatedScene.seed = seed;
+}
+
 void ShapeEditorApplication::run()
 {
+    bool firstFrame = true;
+    bool sceneLoadReported = !editorGUI.isSceneLoading();
+    size_t frameCount = 0;
+    MemoryTelemetry::beginFrameCounting();
     while (!glfwWindowShouldClose(window)) {
         glfwPollEvents();
 
+        // Insert the next chunk of a pending scene before anything reads the shapes this frame
+        const bool wasLoading = editorGUI.isSceneLoading();
+        const size_t shapesLoaded = editorGUI.loadNextSceneChunk();
+        const bool sceneFinished = wasLoading && !editorGUI.isSceneLoading();
+
         ImGui_ImplOpenGL3_NewFrame();
         ImGui_ImplGlfw_NewFrame();
         ImGui::NewFrame();
+        inputRecorder.captureFrame(static_cast<uint32_t>(shapesLoaded), sceneFinished); // No-op unless recording was started
 
         editorGUI.render(); // Render the shape editor GUI
 
         ImGui::Render();
+        updateDrawListGauge();
         int display_w, display_h;
         glfwGetFramebufferSize(window, &display_w, &display_h);
         glViewport(0, 0, display_w, display_h);
@@ -116,16 +189,115 @@ void ShapeEditorApplication::run()
         glClearColor(0.25f, 0.35f, 0.40f, 1.0f); // A more appealing background blue-gray
         glClear(GL_COLOR_BUFFER_BIT);
         ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+        updateGpuMemoryGauge();
 
         glfwSwapBuffers(window);
+        ++frameCount;
+        MemoryTelemetry::endFrame(editorGUI.shapeCount());
+
+        if (firstFrame) {
+            firstFrame = false;
+            startupTimer.mark("First frame");
+            startupTimer.report(std::cout);
+        }
+        if (!sceneLoadReported && !editorGUI.isSceneLoading()) {
+            sceneLoadReported = true;
+            std::cout << "Scene loaded: " << editorGUI.shapeCount() << " shapes after "
+                      << startupTimer.elapsedMs() << " ms (" << frameCount << " frames)" << std::endl;
+        }
+    }
+}
+
+bool ShapeEditorApplication::replay(const std::string& path)
+{
+    InputReplayer replayer;
+    if (!replayer.load(path)) {
+        std::cerr << "Failed to load input log: " << path << std::endl;
+        return false;
+    }
+    // Clicks only hit the same shapes if the scene is the one the session was recorded with
+    if (replayer.scene() != generatedScene) {
+        std::cerr << "Input log " << path << " was recorded with --generate-scene "
+                  << replayer.scene().generatedShapes << " (seed " << replayer.scene().seed
+                  << "), but this run uses --generate-scene " << generatedScene.generatedShapes
+                  << " (seed " << generatedScene.seed << ")" << std::endl;
+        return false;
+    }
+
+    // Headless ImGui context: no window, no GL backend and no vsync, so frames run unthrottled
+    IMGUI_CHECKVERSION();
+    MemoryTelemetry::installImGuiAllocator();
+    ImGui::CreateContext();
+    setupImGuiStyle();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = nullptr; // Window layout must not leak between runs
+    io.ConfigInputTrickleEventQueue = false; // Apply every recorded event in the frame it was captured
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset; // Same draw list limits as the OpenGL3 backend
+    io.Fonts->Build();
+
+    FrameTimeStats stats;
+    MemoryTelemetry::beginFrameCounting();
+    while (replayer.hasNextFrame()) {
+        const RecordedFrame& frame = replayer.feedNextFrame();
+
+        auto frameStart = std::chrono::steady_clock::now();
+        // Load exactly what the recorded frame loaded, so every frame sees the same scene as it did live
+        editorGUI.loadPendingShapeCount(frame.shapesLoaded, frame.sceneFinished);
+        ImGui::NewFrame();
+        editorGUI.render();
+        ImGui::Render();
+        auto frameEnd = std::chrono::steady_clock::now();
+
+        stats.addSample(std::chrono::duration<double, std::milli>(frameEnd - frameStart).count());
+        updateDrawListGauge();
+        MemoryTelemetry::endFrame(editorGUI.shapeCount());
     }
+
+    stats.report(std::cout, ("Replay of " + path).c_str());
+    ImGui::DestroyContext();
+    return true;
+}
+
+void ShapeEditorApplication::updateGpuMemoryGauge()
+{
+    // RGBA32 font atlas plus the textures owned by the editor
+    ImGuiIO& io = ImGui::GetIO();
+    int64_t bytes = static_cast<int64_t>(io.Fonts->TexWidth) * io.Fonts->TexHeight * 4;
+    bytes += static_cast<int64_t>(editorGUI.gpuTextureBytes());
+
+    // The OpenGL3 backend streams every draw list through one VBO/EBO pair sized for the current list
+    int64_t largestList = 0;
+    if (ImDrawData* draw_data = ImGui::GetDrawData()) {
+        for (ImDrawList* list : draw_data->CmdLists) {
+            int64_t listBytes = static_cast<int64_t>(list->VtxBuffer.Size) * sizeof(ImDrawVert) +
+                                static_cast<int64_t>(list->IdxBuffer.Size) * sizeof(ImDrawIdx);
+            largestList = std::max(largestList, listBytes);
+        }
+    }
+    MemoryTelemetry::setGauge(MemorySubsystem::GLBuffers, bytes + largestList);
+}
+
+void ShapeEditorApplication::updateDrawListGauge()
+{
+    int64_t bytes = 0;
+    if (ImDrawData* draw_data = ImGui::GetDrawData()) {
+        for (ImDrawList* list : draw_data->CmdLists) {
+            bytes += static_cast<int64_t>(list->VtxBuffer.Capacity) * sizeof(ImDrawVert) +
+                     static_cast<int64_t>(list->IdxBuffer.Capacity) * sizeof(ImDrawIdx) +
+                     static_cast<int64_t>(list->CmdBuffer.Capacity) * sizeof(ImDrawCmd);
+        }
+    }
+    MemoryTelemetry::setGauge(MemorySubsystem::DrawLists, bytes);
 }
 
 void ShapeEditorApplication::cleanup() {
+    inputRecorder.stop();
+    editorGUI.releaseGpuResources();
     ImGui_ImplOpenGL3_Shutdown();
     ImGui_ImplGlfw_Shutdown();
     ImGui::DestroyContext();
 
     glfwDestroyWindow(window);
     glfwTerminate();
-}
\ No newline at end of file
+}
+
@@ -4,17 +4,46 @@
 
 #pragma once
 #include <iostream>
+#include <string>
 
 #include "shape_editor_gui.h"
+#include "input_recorder.h"
+#include "frame_time_stats.h"
+#include "startup_timer.h"
 class ShapeEditorApplication {
 private:
     GLFWwindow* window;
     ShapeEditorGUI editorGUI;
+    InputRecorder inputRecorder;
+    StartupTimer startupTimer;
+    RecordedScene generatedScene; // Stored in input logs so replay runs against the same scene
+
+    // Applies the IO flags and color theme shared by the windowed and replay runs
+    void setupImGuiStyle();
+
+    // Estimates GPU memory (textures, streamed draw buffers) for the telemetry counters
+    void updateGpuMemoryGauge();
+
+    // Reports the buffer capacity held by the last frame's draw lists, call after ImGui::Render()
+    void updateDrawListGauge();
 
 public:
     bool initialize();
 
+    // Logs the input of every frame of run() to the given file, call after initialize(), generateScene()
+    // and before run(). Window layout is neither loaded from nor saved to imgui.ini while recording.
+    bool startRecording(const std::string& path);
+
+    // Queues a generated test scene of `count` shapes; it streams in while the UI is already interactive
+    void generateScene(size_t count, uint32_t seed = 12345);
+
+    // Main loop. Prints the startup timing report after the first frame is presented.
     void run();
 
+    // Replays a recorded input log without a window and prints frame-time statistics.
+    // Fails if the log was recorded against a different generated scene.
+    // Does not need initialize() or cleanup().
+    bool replay(const std::string& path);
+
     void cleanup();
 };
\ No newline at end of file
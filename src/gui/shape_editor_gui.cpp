@@ -2,6 +2,15 @@
 // Copyright (c) 2025 hung-truong
 
 #include "shape_editor_gui.h"
+
+#include <chrono>
+#include <fstream>
+
+namespace {
+    // Shape::typeName() values offered by the bulk edit type filter
+    const char* BulkTypeNames[] = { "Circle", "Rect", "Polygon", "Polyline" };
+}
+
 void ShapeEditorGUI::render()
 {
     // --- Add the Menu Bar at the top of the entire window ---
@@ -26,6 +35,28 @@ void ShapeEditorGUI::render()
                 }
                 ImGui::EndMenu();
             }
+            if (ImGui::BeginMenu("Options")) {
+                // Counter form stores "Name (Copy N)" as the base name plus a number instead of a new string
+                bool copyCounter = NameTable::global().copyCounterEnabled();
+                if (ImGui::MenuItem("Copy Counter Names", nullptr, &copyCounter)) {
+                    NameTable::global().setCopyCounterEnabled(copyCounter);
+                }
+                ImGui::Separator();
+                ImGui::TextDisabled("Density Overview");
+                if (ImGui::MenuItem("Off", nullptr, overviewMode == OverviewMode::Off)) {
+                    overviewMode = OverviewMode::Off;
+                }
+                if (ImGui::MenuItem("Auto", nullptr, overviewMode == OverviewMode::Auto)) {
+                    overviewMode = OverviewMode::Auto;
+                }
+                if (ImGui::MenuItem("Always", nullptr, overviewMode == OverviewMode::Always)) {
+                    overviewMode = OverviewMode::Always;
+                }
+                ImGui::SliderFloat("Aggregate Below (px)", &overviewSizeThreshold, 1.0f, 16.0f, "%.1f");
+                ImGui::Separator();
+                ImGui::MenuItem("Memory Telemetry", nullptr, &showMemoryPanel);
+                ImGui::EndMenu();
+            }
             ImGui::EndMainMenuBar();
         }
         // Get the height of the menu bar only when it's rendered
@@ -62,6 +93,55 @@ void ShapeEditorGUI::render()
     ImGui::EndChild();
 
     ImGui::End(); // End ImGui window
+
+    if (showMemoryPanel) {
+        renderMemoryPanel();
+    }
+}
+
+void ShapeEditorGUI::renderMemoryPanel()
+{
+    ImGui::SetNextWindowSize(ImVec2(520, 260), ImGuiCond_FirstUseEver);
+    if (!ImGui::Begin("Memory Telemetry", &showMemoryPanel)) {
+        ImGui::End();
+        return;
+    }
+    if (!MemoryTelemetry::isEnabled()) {
+        ImGui::TextDisabled("Built without SHAPEFORGE_MEMORY_TELEMETRY, counters are inactive.");
+    }
+
+    const MemorySnapshot snap = MemoryTelemetry::snapshot();
+    const int64_t sceneBytes = snap.subsystems[static_cast<size_t>(MemorySubsystem::SceneStorage)].liveBytes;
+    ImGui::Text("Frame %llu: %lld allocations, %lld bytes (peak %lld allocations)",
+                static_cast<unsigned long long>(snap.frame), static_cast<long long>(snap.frameAllocations),
+                static_cast<long long>(snap.frameBytes), static_cast<long long>(snap.peakFrameAllocations));
+    ImGui::Text("Scene bytes per shape: %.1f", shapes.empty() ? 0.0 : static_cast<double>(sceneBytes) / shapes.size());
+
+    if (ImGui::BeginTable("MemoryCounters", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+        ImGui::TableSetupColumn("Subsystem");
+        ImGui::TableSetupColumn("Live KB");
+        ImGui::TableSetupColumn("Live allocs");
+        ImGui::TableSetupColumn("Total allocs");
+        ImGui::TableSetupColumn("Total KB");
+        ImGui::TableHeadersRow();
+        for (size_t i = 0; i < static_cast<size_t>(MemorySubsystem::Count); ++i) {
+            const SubsystemStats& s = snap.subsystems[i];
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn(); ImGui::TextUnformatted(MemoryTelemetry::subsystemName(static_cast<MemorySubsystem>(i)));
+            ImGui::TableNextColumn(); ImGui::Text("%.1f", s.liveBytes / 1024.0);
+            ImGui::TableNextColumn(); ImGui::Text("%lld", static_cast<long long>(s.liveAllocations));
+            ImGui::TableNextColumn(); ImGui::Text("%lld", static_cast<long long>(s.totalAllocations));
+            ImGui::TableNextColumn(); ImGui::Text("%.1f", s.totalBytes / 1024.0);
+        }
+        ImGui::EndTable();
+    }
+
+    if (ImGui::Button("Export Snapshot")) {
+        std::ofstream out("memory_snapshot.json", std::ios::trunc);
+        MemoryTelemetry::writeJson(out, snap, shapes.size());
+        out << '\n';
+    }
+    ImGui::End();
 }
 
 void ShapeEditorGUI::renderControlsPanel()
@@ -94,83 +174,266 @@ void ShapeEditorGUI::renderControlsPanel()
 
     ImGui::Separator();
 
+    // PolygonShape / PolylineShape creation
+    ImGui::Text("Polygon / Polyline Properties:");
+    ImGui::SliderInt("Vertices", &newPathVertexCount, 3, 4096, "%d", ImGuiSliderFlags_Logarithmic);
+    if (ImGui::Button("Add Polygon", ImVec2(120, 0))) {
+        addShape<PolygonShape>(ImVec2(200,200), PolygonShape::makeStar(newPathVertexCount, newCircleRadius)); // Default pos
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Add Polyline", ImVec2(120, 0))) {
+        addShape<PolylineShape>(ImVec2(50,200), PolylineShape::makeWave(newPathVertexCount, 300.0f, 40.0f)); // Default pos
+    }
+
+    ImGui::Separator();
+
+    renderBulkEditControls();
+
+    ImGui::Separator();
+
     // Shape List and Properties
     ImGui::Text("Shapes (%zu):", shapes.size());
+    if (sceneLoader.isLoading()) {
+        char progress_label[64];
+        if (sceneLoader.expected() > 0) {
+            snprintf(progress_label, sizeof(progress_label), "Loading %zu / %zu", sceneLoader.loaded(), sceneLoader.expected());
+        } else {
+            snprintf(progress_label, sizeof(progress_label), "Loading %zu", sceneLoader.loaded());
+        }
+        ImGui::ProgressBar(sceneLoader.progress(), ImVec2(-1.0f, 0.0f), progress_label);
+    }
     // Use ImGui::GetContentRegionAvail().y to make the child window fill remaining vertical space
     // Subtract space for the "Quit Application" button and its spacing
     float remaining_height_for_list = ImGui::GetContentRegionAvail().y - ImGui::GetFrameHeightWithSpacing() - ImGui::GetStyle().ItemSpacing.y;
     ImGui::BeginChild("ShapeList", ImVec2(0, remaining_height_for_list), true);
-    for (int i = 0; i < shapes.size(); ++i) {
-        ImGui::PushID(i);
-        bool isCurrentSelected = (selectedShapeIndex == i);
-
-        // Using a char buffer and sprintf for string formatting
-        char label_buffer[256]; // Sufficiently large buffer
-        const char* shape_type = (dynamic_cast<CircleShape*>(shapes[i].get()) ? "Circle" : "Rect");
-        snprintf(label_buffer, sizeof(label_buffer),"%s (%s @ %.0f,%.0f)",
-                shapes[i]->name.c_str(), shape_type,
-                shapes[i]->position.x, shapes[i]->position.y);
-
-        if (ImGui::Selectable(label_buffer, isCurrentSelected)) { // Use the buffer here
-            if (selectedShapeIndex != -1) {
-                shapes[selectedShapeIndex]->isSelected = false; // Deselect previous
+    // Only visible rows are formatted and submitted, so the list costs the same for any scene size.
+    // The selected row carries its property editor and is taller than the others, so the rows
+    // before and after it are clipped separately.
+    auto renderClippedRows = [this](int begin, int end) {
+        ImGuiListClipper clipper;
+        clipper.Begin(end - begin);
+        while (clipper.Step()) {
+            for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row) {
+                renderShapeListRow(begin + row);
             }
-            selectedShapeIndex = i;
-            shapes[selectedShapeIndex]->isSelected = true; // Select new
         }
-
-        if (isCurrentSelected) {
-            ImGui::Indent();
-            ImGui::Text("Properties:");
-            ImGui::ColorEdit3("Color##Edit", shapes[i]->color.data()); // Convert to float* raw pointer for IMGUI
-            ImGui::InputFloat2("Position##Edit", (float*)&shapes[i]->position);
-
-            // Specific properties for CircleShape
-            if (auto* circle = dynamic_cast<CircleShape*>(shapes[i].get())) {
-                ImGui::SliderFloat("Radius##Edit", &circle->radius, 10.0f, 150.0f, "%.1f");
-            }
-            // Specific properties for RectangleShape
-            else if (auto* rect = dynamic_cast<RectangleShape*>(shapes[i].get())) {
-                ImGui::SliderFloat2("Size##Edit", (float*)&rect->size, 10.0f, 200.0f, "%.1f");
-            }
-
-            if (ImGui::Button("Delete", ImVec2(80, 0))) {
-                shapes.erase(shapes.begin() + i);
-                selectedShapeIndex = -1;
-                ImGui::PopID();
-                break; // Break loop as vector size changed
-            }
-            ImGui::Unindent();
+    };
+    const int selected = selectedShapeIndex;
+    if (selected < 0 || selected >= static_cast<int>(shapes.size())) {
+        renderClippedRows(0, static_cast<int>(shapes.size()));
+    } else {
+        renderClippedRows(0, selected);
+        renderShapeListRow(selected);
+        // A click on another row this frame hides the editor; a delete shifts the remaining rows,
+        // so they are left for the next frame like the original loop did
+        const bool deleted = selectedShapeIndex == selected && renderSelectedShapeProperties();
+        if (!deleted) {
+            renderClippedRows(selected + 1, static_cast<int>(shapes.size()));
         }
-        ImGui::PopID();
     }
     ImGui::EndChild();
 
     ImGui::Separator();
     // Exit Button
     if (ImGui::Button("Quit Application", ImVec2(0, 0))) {
-        // Signal GLFW to close the window
-        glfwSetWindowShouldClose(glfwGetCurrentContext(), true);
+        // Signal GLFW to close the window (there is none during a headless replay)
+        if (GLFWwindow* current_window = glfwGetCurrentContext()) {
+            glfwSetWindowShouldClose(current_window, true);
+        }
     }
 }
 
+void ShapeEditorGUI::renderBulkEditControls()
+{
+    if (!ImGui::CollapsingHeader("Bulk Edit")) {
+        return;
+    }
+
+    static const char* target_labels[] = { "Selected", "All", "Type", "Name Contains" };
+    ImGui::Combo("Target##Bulk", &bulkTarget, target_labels, IM_ARRAYSIZE(target_labels));
+    if (bulkTarget == static_cast<int>(BulkTarget::Type)) {
+        ImGui::Combo("Type##Bulk", &bulkTypeIndex, BulkTypeNames, IM_ARRAYSIZE(BulkTypeNames));
+    } else if (bulkTarget == static_cast<int>(BulkTarget::NameContains)) {
+        ImGui::InputText("Name##Bulk", bulkNameFilter, sizeof(bulkNameFilter));
+    }
+
+    ImGui::InputFloat2("Offset##Bulk", (float*)&bulkTranslation);
+    if (ImGui::Button("Translate", ImVec2(120, 0))) {
+        applyBulkEdit(true, [&](const std::vector<uint32_t>& targets) {
+            BulkEdit::translate(shapes, targets, bulkTranslation);
+        });
+    }
+
+    ImGui::SliderFloat("Factor##Bulk", &bulkScaleFactor, 0.1f, 4.0f, "%.2f", ImGuiSliderFlags_Logarithmic);
+    if (ImGui::Button("Scale", ImVec2(120, 0))) {
+        applyBulkEdit(true, [&](const std::vector<uint32_t>& targets) {
+            BulkEdit::scale(shapes, targets, bulkScaleFactor);
+        });
+    }
+
+    ImGui::ColorEdit3("Color##Bulk", bulkColor.data());
+    if (ImGui::Button("Recolor", ImVec2(120, 0))) {
+        applyBulkEdit(false, [&](const std::vector<uint32_t>& targets) {
+            BulkEdit::recolor(shapes, targets, bulkColor);
+        });
+    }
+
+    ImGui::Text("Align:");
+    static const char* align_labels[] = { "Left", "Right", "Top", "Bottom" };
+    for (int i = 0; i < IM_ARRAYSIZE(align_labels); ++i) {
+        if (i > 0) ImGui::SameLine();
+        if (ImGui::Button(align_labels[i])) {
+            applyBulkEdit(true, [&](const std::vector<uint32_t>& targets) {
+                BulkEdit::align(shapes, targets, static_cast<BulkAlign>(i));
+            });
+        }
+    }
+    ImGui::Text("Distribute:");
+    if (ImGui::Button("Horizontally")) {
+        applyBulkEdit(true, [&](const std::vector<uint32_t>& targets) {
+            BulkEdit::distribute(shapes, targets, BulkAxis::Horizontal);
+        });
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Vertically")) {
+        applyBulkEdit(true, [&](const std::vector<uint32_t>& targets) {
+            BulkEdit::distribute(shapes, targets, BulkAxis::Vertical);
+        });
+    }
+
+    // Test data: each press uses the next seed, so results are reproducible across runs
+    ImGui::Text("Randomize (seed %llu):", static_cast<unsigned long long>(bulkRandomSeed));
+    if (ImGui::Button("Positions")) {
+        applyBulkEdit(true, [&](const std::vector<uint32_t>& targets) {
+            BulkEdit::randomize(shapes, targets, lastCanvasSize, bulkRandomSeed++, true, false);
+        });
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Colors")) {
+        applyBulkEdit(false, [&](const std::vector<uint32_t>& targets) {
+            BulkEdit::randomize(shapes, targets, lastCanvasSize, bulkRandomSeed++, false, true);
+        });
+    }
+
+    ImGui::Text("Last edit: %zu shapes in %.2f ms", lastBulkEditCount, lastBulkEditMs);
+}
+
+template<typename Edit>
+void ShapeEditorGUI::applyBulkEdit(bool clampAfter, Edit&& edit)
+{
+    BulkFilter filter;
+    filter.target = static_cast<BulkTarget>(bulkTarget);
+    filter.typeName = BulkTypeNames[bulkTypeIndex];
+    filter.nameText = bulkNameFilter;
+
+    const auto start = std::chrono::steady_clock::now();
+    const std::vector<uint32_t> targets = BulkEdit::collect(shapes, selectedShapeIndex, filter);
+    edit(targets);
+    // Nothing to clamp against before the canvas has been laid out once
+    if (clampAfter && lastCanvasSize.x > 0.0f) {
+        BulkEdit::clampToCanvas(shapes, targets, lastCanvasSize);
+    }
+    lastBulkEditMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    lastBulkEditCount = targets.size();
+    if (!targets.empty()) {
+        ++sceneVersion;
+    }
+}
+
+void ShapeEditorGUI::renderShapeListRow(int i)
+{
+    ImGui::PushID(i);
+    bool isCurrentSelected = (selectedShapeIndex == i);
+
+    // Using a char buffer and sprintf for string formatting
+    char name_buffer[160];
+    NameTable::global().format(shapes[i]->name, name_buffer, sizeof(name_buffer));
+    char label_buffer[256]; // Sufficiently large buffer
+    const char* shape_type = shapes[i]->typeName();
+    snprintf(label_buffer, sizeof(label_buffer),"%s (%s @ %.0f,%.0f)",
+            name_buffer, shape_type,
+            shapes[i]->position.x, shapes[i]->position.y);
+
+    if (ImGui::Selectable(label_buffer, isCurrentSelected)) { // Use the buffer here
+        if (selectedShapeIndex != -1) {
+            shapes[selectedShapeIndex]->isSelected = false; // Deselect previous
+        }
+        selectedShapeIndex = i;
+        shapes[selectedShapeIndex]->isSelected = true; // Select new
+    }
+    ImGui::PopID();
+}
+
+bool ShapeEditorGUI::renderSelectedShapeProperties()
+{
+    const int i = selectedShapeIndex;
+    ImGui::PushID(i);
+    ImGui::Indent();
+    ImGui::Text("Properties:");
+    if (ImGui::ColorEdit3("Color##Edit", shapes[i]->color.data())) { // Convert to float* raw pointer for IMGUI
+        shapes[i]->updatePackedColor();
+    }
+    ImGui::InputFloat2("Position##Edit", (float*)&shapes[i]->position);
+
+    // Specific properties for CircleShape
+    if (auto* circle = dynamic_cast<CircleShape*>(shapes[i].get())) {
+        ImGui::SliderFloat("Radius##Edit", &circle->radius, 10.0f, 150.0f, "%.1f");
+    }
+    // Specific properties for RectangleShape
+    else if (auto* rect = dynamic_cast<RectangleShape*>(shapes[i].get())) {
+        ImGui::SliderFloat2("Size##Edit", (float*)&rect->size, 10.0f, 200.0f, "%.1f");
+    }
+    // Specific properties for PolygonShape / PolylineShape
+    else if (auto* path = dynamic_cast<PathShape*>(shapes[i].get())) {
+        ImGui::Text("Vertices: %zu, Triangles: %zu", path->vertexCount(), path->triangleCount());
+        if (auto* polyline = dynamic_cast<PolylineShape*>(path)) {
+            // Go through the setter so the cached stroke mesh is rebuilt
+            float thickness = polyline->getThickness();
+            if (ImGui::SliderFloat("Thickness##Edit", &thickness, 1.0f, 20.0f, "%.1f")) {
+                polyline->setThickness(thickness);
+            }
+        }
+    }
+
+    bool deleted = false;
+    if (ImGui::Button("Delete", ImVec2(80, 0))) {
+        shapes.erase(shapes.begin() + i);
+        selectedShapeIndex = -1;
+        ++sceneVersion;
+        deleted = true;
+    }
+    ImGui::Unindent();
+    ImGui::PopID();
+    return deleted;
+}
+
 void ShapeEditorGUI::handleMouseShape(const bool& is_canvas_hovered, const ImVec2& mouse_pos_in_canvas)
 {
     // --- Cursor logic for shapes ---
     if (is_canvas_hovered) {
         bool shapeHovered = false;
-        // Iterate through shapes in reverse order to check for the topmost shape
-        for (int i = shapes.size() - 1; i >= 0; --i) {
-            if (shapes[i]->contains(mouse_pos_in_canvas)) {
-                // If a shape is being dragged, show the grab cursor
-                if (selectedShapeIndex != -1 && ImGui::IsMouseDragging(ImGuiMouseButton_Left)) {
-                    ImGui::SetMouseCursor(ImGuiMouseCursor_ResizeAll);
-                } else {
-                    // Otherwise, show the hand cursor for hovering
-                    ImGui::SetMouseCursor(ImGuiMouseCursor_Hand);
+        if (isOverviewActive()) {
+            // Scanning a scene this large every hovered frame would cost more than the overview saves,
+            // even for the shapes drawn individually, which can still be most of the scene. Only the
+            // selected shape gets hover feedback; clicks still hit-test the whole scene.
+            shapeHovered = selectedShapeIndex >= 0 && selectedShapeIndex < static_cast<int>(shapes.size()) &&
+                           shapes[selectedShapeIndex]->contains(mouse_pos_in_canvas);
+        } else {
+            // Iterate through shapes in reverse order to check for the topmost shape
+            for (int i = static_cast<int>(shapes.size()) - 1; i >= 0; --i) {
+                if (shapes[i]->contains(mouse_pos_in_canvas)) {
+                    shapeHovered = true;
+                    break; // Found the topmost shape, no need to check others
                 }
-                shapeHovered = true;
-                break; // Found the topmost shape, no need to check others
+            }
+        }
+        if (shapeHovered) {
+            // If a shape is being dragged, show the grab cursor
+            if (selectedShapeIndex != -1 && ImGui::IsMouseDragging(ImGuiMouseButton_Left)) {
+                ImGui::SetMouseCursor(ImGuiMouseCursor_ResizeAll);
+            } else {
+                // Otherwise, show the hand cursor for hovering
+                ImGui::SetMouseCursor(ImGuiMouseCursor_Hand);
             }
         }
         // If nothing is hovered, revert to the default arrow
@@ -220,6 +483,7 @@ void ShapeEditorGUI::renderCanvasPanel() {
         ImVec2 canvas_size = ImGui::GetContentRegionAvail(); // Available space for canvas
         if (canvas_size.x < 50.0f) canvas_size.x = 50.0f;
         if (canvas_size.y < 50.0f) canvas_size.y = 50.0f;
+        lastCanvasSize = canvas_size;
 
         // Draw a background for the canvas
         ImDrawList* draw_list = ImGui::GetWindowDrawList();
@@ -275,17 +539,69 @@ void ShapeEditorGUI::renderCanvasPanel() {
         }
 
         // Draw all shapes
-        for (const auto& shape_ptr : shapes) {
-            shape_ptr->draw(draw_list, canvas_pos); // Pass canvas_pos for correct drawing
-        }
+        drawShapes(draw_list, canvas_pos, canvas_size);
+    }
+
+void ShapeEditorGUI::drawShapes(ImDrawList* draw_list, const ImVec2& canvas_pos, const ImVec2& canvas_size)
+{
+    if (isOverviewActive()) {
+        // Cached between frames; only rebuilt when the scene, selection or canvas size changes
+        densityRenderer.update(shapes, sceneVersion, selectedShapeIndex, canvas_size, overviewSizeThreshold);
+        draw_list->PushClipRect(canvas_pos, ImVec2(canvas_pos.x + canvas_size.x, canvas_pos.y + canvas_size.y), true);
+        densityRenderer.draw(draw_list, canvas_pos, shapes, selectedShapeIndex);
+        draw_list->PopClipRect();
+        return;
     }
 
+    // Shapes can be dragged while the overview is off without bumping the version, so the
+    // cached grid can't be trusted once it is turned back on
+    densityRenderer.invalidate();
+
+    for (const auto& shape_ptr : shapes) {
+        shape_ptr->draw(draw_list, canvas_pos); // Pass canvas_pos for correct drawing
+    }
+}
+
+void ShapeEditorGUI::releaseGpuResources()
+{
+    densityRenderer.releaseTexture();
+}
+
+void ShapeEditorGUI::loadScene(ShapeSource source, size_t expectedCount)
+{
+    // Reserve once up front so chunked insertion never pays for a large reallocation mid-frame
+    if (expectedCount > 0) {
+        MemoryScope scope(MemorySubsystem::SceneStorage);
+        shapes.reserve(shapes.size() + expectedCount);
+    }
+    sceneLoader.start(std::move(source), expectedCount);
+}
+
+size_t ShapeEditorGUI::loadPendingShapes(double budgetMs)
+{
+    MemoryScope scope(MemorySubsystem::SceneStorage);
+    // Appends only, no version bump: the density overview adds the new tail to its grid
+    return sceneLoader.loadChunk(shapes, budgetMs);
+}
+
+size_t ShapeEditorGUI::loadPendingShapeCount(size_t count, bool finished)
+{
+    MemoryScope scope(MemorySubsystem::SceneStorage);
+    const size_t added = sceneLoader.loadCount(shapes, count);
+    if (finished) {
+        sceneLoader.finish();
+    }
+    return added;
+}
+
 template<typename T, typename... Args>
 void ShapeEditorGUI::addShape(Args&&... args) {
-    std::string shapeName(newShapeNameBuffer);  // Create string
-    shapes.push_back(std::make_unique<T>(std::forward<Args>(args)... , newShapeColor, std::move(shapeName)));
+    MemoryScope scope(MemorySubsystem::SceneStorage);
+    ShapeName shapeName = NameTable::global().makeName(newShapeNameBuffer); // Interned, no per-shape string
+    shapes.push_back(std::make_unique<T>(std::forward<Args>(args)... , newShapeColor, shapeName));
     // Reset name buffer after adding
     newShapeNameBuffer[0] = '\0';
+    ++sceneVersion;
     // Select the newly added shape
     if (selectedShapeIndex != -1) {
         shapes[selectedShapeIndex]->isSelected = false;
@@ -298,6 +614,7 @@ void ShapeEditorGUI::deleteShape() {
     if (selectedShapeIndex == -1) return;
     shapes.erase(shapes.begin() + selectedShapeIndex);
     selectedShapeIndex = -1;
+    ++sceneVersion;
 }
 
 void ShapeEditorGUI::copyShape()
@@ -310,6 +627,7 @@ void ShapeEditorGUI::copyShape()
 
 void ShapeEditorGUI::pasteShape()
 {
+    MemoryScope scope(MemorySubsystem::SceneStorage);
     auto newShape = clipboardSystem.createPastedShape();
     if (!newShape) {
         return;
@@ -321,6 +639,7 @@ void ShapeEditorGUI::pasteShape()
 
     // Push and select the new object
     shapes.push_back(std::move(newShape));
+    ++sceneVersion;
     selectedShapeIndex = shapes.size() - 1;
     shapes[selectedShapeIndex]->isSelected = true;
 }
@@ -6,7 +6,13 @@
 #include "shape.h"
 #include "circle.h"
 #include "rectangle.h"
+#include "polygon.h"
+#include "polyline.h"
 #include "shape_clipboard.h"
+#include "progressive_scene_loader.h"
+#include "density_renderer.h"
+#include "memory_telemetry.h"
+#include "bulk_edit.h"
 
 class ShapeEditorGUI {
 private:
@@ -17,11 +23,40 @@ private:
     // For new shape creation (these are now defaults for the "Add" buttons, not click-to-add)
     float newCircleRadius = 50.0f;
     ImVec2 newRectSize = ImVec2(80, 60);
+    int newPathVertexCount = 64;
     std::array<float, 3> newShapeColor = {1.0f, 1.0f, 1.0f}; // RGB as floats (white by default)
     char newShapeNameBuffer[128] = ""; // For C-style string input
     bool showMenuBar = false;
     // Clipboard system
     ShapeClipboard clipboardSystem;
+    // Large scenes are streamed into `shapes` a few milliseconds per frame
+    ProgressiveSceneLoader sceneLoader;
+    double sceneLoadBudgetMs = 2.0;
+
+    // Bumped whenever shapes are added, removed or bulk edited; selected-shape edits don't count
+    // because the density overview always draws the selected shape on its own. Appends from the
+    // scene loader don't count either, the overview picks them up from the shape count.
+    uint64_t sceneVersion = 0;
+    // Density overview: shapes smaller than the threshold are drawn as one aggregated texture
+    enum class OverviewMode { Off, Auto, Always };
+    OverviewMode overviewMode = OverviewMode::Auto;
+    float overviewSizeThreshold = 3.0f; // Pixels
+    size_t overviewAutoShapeCount = 20000; // Auto mode aggregates from this many shapes on
+    DensityRenderer densityRenderer;
+    bool showMemoryPanel = false;
+
+    // Bulk edit settings, applied to every shape matching the filter
+    int bulkTarget = static_cast<int>(BulkTarget::All);
+    int bulkTypeIndex = 0;
+    char bulkNameFilter[128] = "";
+    ImVec2 bulkTranslation = ImVec2(10.0f, 0.0f);
+    float bulkScaleFactor = 1.1f;
+    std::array<float, 3> bulkColor = {1.0f, 0.5f, 0.0f};
+    uint64_t bulkRandomSeed = 1;
+    size_t lastBulkEditCount = 0;
+    double lastBulkEditMs = 0.0;
+    // Canvas size from the last rendered frame, used to clamp bulk edits
+    ImVec2 lastCanvasSize = ImVec2(0.0f, 0.0f);
 
 public:
     ShapeEditorGUI() {
@@ -33,13 +68,54 @@ public:
     }
     void render();
 
+    // Queues a scene to be appended to the canvas progressively, starting with the next loadNextSceneChunk().
+    // Shapes already inserted are drawn and selectable while the rest keep loading.
+    void loadScene(ShapeSource source, size_t expectedCount = 0);
+
+    // Inserts pending scene shapes for up to budgetMs (negative = until done), returns how many were added
+    size_t loadPendingShapes(double budgetMs);
+
+    // Inserts the next time-budgeted chunk of a pending scene, call once per frame before render()
+    size_t loadNextSceneChunk() { return loadPendingShapes(sceneLoadBudgetMs); }
+
+    // Inserts exactly `count` pending scene shapes, for replaying a recorded load.
+    // `finished` ends the load afterwards, in the frame where the recorded run saw it end.
+    size_t loadPendingShapeCount(size_t count, bool finished);
+
+    bool isSceneLoading() const { return sceneLoader.isLoading(); }
+
+    size_t shapeCount() const { return shapes.size(); }
+
+    // Frees GL objects owned by the GUI, call before the GL context is destroyed
+    void releaseGpuResources();
+
+    // GPU memory held by textures the GUI created itself
+    size_t gpuTextureBytes() const { return densityRenderer.textureBytes(); }
+
 private:
     // The Function render the control panel on the left side of the application
     void renderControlsPanel();
 
+    // One selectable row of the shape list
+    void renderShapeListRow(int index);
+
+    // Property editor shown under the selected row. Returns true if the shape was deleted.
+    bool renderSelectedShapeProperties();
+
     // The function render the canvas panel on the right side of the application
     void renderCanvasPanel();
 
+    // Collapsible section of the control panel with the bulk edit operations
+    void renderBulkEditControls();
+
+    // Collects the shapes matching the bulk filter, applies `edit` to them and, for edits that
+    // move or resize shapes, clamps them back onto the canvas. The scene counts as changed once.
+    template<typename Edit>
+    void applyBulkEdit(bool clampAfter, Edit&& edit);
+
+    // Floating window with the per-subsystem memory counters, toggled from the Options menu
+    void renderMemoryPanel();
+
     // Renders a right-click context menu on the canvas area.
     // Offers options to cut, copy, paste, or delete the currently selected shape.
     void renderCanvasContextMenu(const bool& is_canvas_hovered);
@@ -63,6 +139,15 @@ private:
     // Deletes the currently selected shape from the canvas.
     void deleteShape();
 
+    // True when the density overview replaces per-shape drawing for the current scene
+    bool isOverviewActive() const {
+        return overviewMode == OverviewMode::Always ||
+               (overviewMode == OverviewMode::Auto && shapes.size() >= overviewAutoShapeCount);
+    }
+
+    // Draws every shape, or the density overview when it is enabled for the current scene
+    void drawShapes(ImDrawList* draw_list, const ImVec2& canvas_pos, const ImVec2& canvas_size);
+
     // The function handle the logic for changing shape of cursor, when hover or dragging shape object
     void handleMouseShape(const bool& is_canvas_hovered, const ImVec2& mouse_pos_in_canvas);
 
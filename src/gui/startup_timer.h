@@ -0,0 +1,52 @@
+//========================================================================
+// Copyright (c) 2025 hung-truong
+// --- Measures the startup phases up to the first interactive frame ---
+
+#pragma once
+#include <chrono>
+#include <cstdio>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+class StartupTimer {
+private:
+    using Clock = std::chrono::steady_clock;
+
+    Clock::time_point startTime;
+    Clock::time_point lastMark;
+    std::vector<std::pair<std::string, double>> phases; // Phase name and its duration in milliseconds
+
+    static double millisecondsBetween(Clock::time_point from, Clock::time_point to) {
+        return std::chrono::duration<double, std::milli>(to - from).count();
+    }
+
+public:
+    void start() {
+        startTime = lastMark = Clock::now();
+        phases.clear();
+    }
+
+    // Closes the current phase: its duration is the time since the previous mark (or start())
+    void mark(const char* phase) {
+        Clock::time_point now = Clock::now();
+        phases.emplace_back(phase, millisecondsBetween(lastMark, now));
+        lastMark = now;
+    }
+
+    double elapsedMs() const { return millisecondsBetween(startTime, Clock::now()); }
+
+    void report(std::ostream& os) const {
+        os << "--- Startup timing ---\n";
+        char line[256];
+        double total = 0.0;
+        for (const auto& [phase, ms] : phases) {
+            snprintf(line, sizeof(line), "  %-24s %8.2f ms\n", phase.c_str(), ms);
+            os << line;
+            total += ms;
+        }
+        snprintf(line, sizeof(line), "  %-24s %8.2f ms\n", "Time to interactive", total);
+        os << line;
+    }
+};
@@ -0,0 +1,100 @@
+//========================================================================
+// Copyright (c) 2025 hung-truong
+
+#include "thread_pool.h"
+
+#include <algorithm>
+
+namespace {
+    thread_local bool insidePoolTask = false;
+}
+
+ThreadPool::ThreadPool(size_t workerCount)
+{
+    workers.reserve(workerCount);
+    for (size_t i = 0; i < workerCount; ++i) {
+        workers.emplace_back([this]() { workerLoop(); });
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+ThreadPool& ThreadPool::global()
+{
+    static ThreadPool pool(std::max(1u, std::thread::hardware_concurrency()) - 1);
+    return pool;
+}
+
+void ThreadPool::runTasks(const std::function<void(size_t)>& batch, size_t count)
+{
+    insidePoolTask = true;
+    for (size_t i = nextTask.fetch_add(1); i < count; i = nextTask.fetch_add(1)) {
+        batch(i);
+        if (finishedTasks.fetch_add(1) + 1 == count) {
+            std::lock_guard<std::mutex> lock(mutex);
+            done.notify_all();
+        }
+    }
+    insidePoolTask = false;
+}
+
+void ThreadPool::workerLoop()
+{
+    uint64_t seenGeneration = 0;
+    while (true) {
+        const std::function<void(size_t)>* batch = nullptr;
+        size_t count = 0;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [&]() { return stopping || generation != seenGeneration; });
+            if (stopping) return;
+            seenGeneration = generation;
+            batch = task;
+            count = taskCount;
+            if (!batch) continue; // Woke up after the batch had already drained
+            ++activeWorkers;
+        }
+
+        runTasks(*batch, count);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        --activeWorkers;
+        done.notify_all();
+    }
+}
+
+void ThreadPool::run(size_t count, const std::function<void(size_t)>& batch)
+{
+    if (count == 0) return;
+    if (workers.empty() || count == 1 || insidePoolTask) {
+        for (size_t i = 0; i < count; ++i) batch(i);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        task = &batch;
+        taskCount = count;
+        nextTask = 0;
+        finishedTasks = 0;
+        ++generation;
+    }
+    wake.notify_all();
+
+    runTasks(batch, count);
+
+    // `batch` lives on the caller's stack, so wait until no worker can still touch it
+    std::unique_lock<std::mutex> lock(mutex);
+    done.wait(lock, [&]() { return finishedTasks.load() == count && activeWorkers == 0; });
+    task = nullptr;
+}
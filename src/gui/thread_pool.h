@@ -0,0 +1,50 @@
+//========================================================================
+// Copyright (c) 2025 hung-truong
+// --- Persistent worker threads for scene-wide parallel passes ---
+
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Runs one batch of tasks at a time on long-lived workers, so parallel loops that run
+// every frame or on every edit do not pay for thread creation.
+class ThreadPool {
+private:
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable wake; // Workers wait here for a new batch
+    std::condition_variable done; // run() waits here for the batch to drain
+
+    // Current batch, published under `mutex` together with a new generation
+    const std::function<void(size_t)>* task = nullptr;
+    size_t taskCount = 0;
+    uint64_t generation = 0;
+    std::atomic<size_t> nextTask{0};
+    std::atomic<size_t> finishedTasks{0};
+    size_t activeWorkers = 0; // Workers still holding a pointer to the current batch
+    bool stopping = false;
+
+    void workerLoop();
+    void runTasks(const std::function<void(size_t)>& batch, size_t count);
+
+public:
+    explicit ThreadPool(size_t workerCount);
+    ~ThreadPool();
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // One worker per hardware thread besides the caller
+    static ThreadPool& global();
+
+    // Threads that execute a batch, including the calling thread
+    size_t concurrency() const { return workers.size() + 1; }
+
+    // Calls batch(i) for every i in [0, count) and returns once all calls finished.
+    // The calling thread takes part. Nested calls from inside a task run inline.
+    void run(size_t count, const std::function<void(size_t)>& batch);
+};
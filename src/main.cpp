@@ -4,16 +4,56 @@
 #include "gui/circle.h"
 #include "gui/shape_editor_gui.h"
 #include "gui/shape_editor_application.h"
+#include <cstdlib>
 #include <iostream>
+#include <string>
 
 // --- Main Entry Point ---
-int main() {
+// Usage: shape-forge [--generate-scene <count>] [--memory-snapshots <file.jsonl>]
+//                    [--record <input.log> | --replay <input.log>]
+int main(int argc, char** argv) {
+    std::string recordPath;
+    std::string replayPath;
+    size_t generatedSceneSize = 0;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--record" && i + 1 < argc) {
+            recordPath = argv[++i];
+        } else if (arg == "--replay" && i + 1 < argc) {
+            replayPath = argv[++i];
+        } else if (arg == "--memory-snapshots" && i + 1 < argc) {
+            if (!MemoryTelemetry::startSnapshots(argv[++i])) {
+                std::cerr << "Failed to open memory snapshot file: " << argv[i] << std::endl;
+                return -1;
+            }
+        } else if (arg == "--generate-scene" && i + 1 < argc) {
+            generatedSceneSize = std::strtoull(argv[++i], nullptr, 10);
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--generate-scene <count>] [--memory-snapshots <file.jsonl>]"
+                      << " [--record <input.log> | --replay <input.log>]" << std::endl;
+            return -1;
+        }
+    }
+
     ShapeEditorApplication app;
+    if (generatedSceneSize > 0) {
+        app.generateScene(generatedSceneSize);
+    }
+
+    // Deterministic headless replay of a recorded session, no window is created
+    if (!replayPath.empty()) {
+        return app.replay(replayPath) ? 0 : -1;
+    }
 
     if (!app.initialize()) {
         return -1;
     }
 
+    if (!recordPath.empty() && !app.startRecording(recordPath)) {
+        app.cleanup();
+        return -1;
+    }
+
     app.run();
     app.cleanup();
 